@@ -0,0 +1,969 @@
+/**************************************************************************************************
+ * Copyright (c) 2023-2025 NWSOFT                                                                 *
+ *                                                                                                *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy                   *
+ * of this software and associated documentation files (the "Software"), to deal                  *
+ * in the Software without restriction, including without limitation the rights                   *
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell                      *
+ * copies of the Software, and to permit persons to whom the Software is                          *
+ * furnished to do so, subject to the following conditions:                                       *
+ *                                                                                                *
+ * The above copyright notice and this permission notice shall be included in all                 *
+ * copies or substantial portions of the Software.                                                *
+ *                                                                                                *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR                     *
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,                       *
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE                    *
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER                         *
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,                  *
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE                  *
+ * SOFTWARE.                                                                                      *
+ **************************************************************************************************/
+
+/**
+ * @file bignum.hpp
+ * @brief Contains the limb-based arbitrary precision backend used underneath the string functions and Number.
+ *
+ * @author Andy Zhang
+ * @date 16th October 2026
+ */
+
+#pragma once
+
+#include <atomic>
+#include <compare>
+#include <concepts>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+/**
+ * @namespace steppable::__internals::bignum
+ * @brief Limb-based arithmetic on decimal numbers. Magnitudes are stored as base-10^9 limbs, least significant limb
+ * first, so that converting from and to decimal strings takes linear time.
+ */
+namespace steppable::__internals::bignum
+{
+    /// @brief A single base-10^9 digit.
+    using Limb = std::uint32_t;
+
+    /// @brief A magnitude, stored least significant limb first. An empty vector represents zero.
+    using Limbs = std::vector<Limb>;
+
+    /// @brief The base of each limb.
+    constexpr Limb LIMB_BASE = 1'000'000'000;
+
+    /// @brief The number of decimal digits stored in each limb.
+    constexpr long long LIMB_DIGITS = 9;
+
+    /// @brief Powers of ten that fit in a limb, indexed by the exponent.
+    constexpr Limb POW10[] = { 1, 10, 100, 1'000, 10'000, 100'000, 1'000'000, 10'000'000, 100'000'000 };
+
+    /**
+     * @struct BigDecimal
+     * @brief A signed decimal number, equal to (-1)^negative * mantissa * 10^exponent.
+     *
+     * @details The exponent keeps track of the number of decimal places the number was written with, so "1.50" is
+     * stored as 150 * 10^-2 and is printed back as "1.50". Zero is represented by an empty mantissa and is never
+     * negative.
+     */
+    struct BigDecimal
+    {
+        /// @brief The digits of the number, as base-10^9 limbs.
+        Limbs mantissa;
+
+        /// @brief The power of ten the mantissa is multiplied by.
+        long long exponent = 0;
+
+        /// @brief Whether the number is negative.
+        bool negative = false;
+
+        /**
+         * @brief Checks whether the number is zero.
+         * @return True if the number is zero, false otherwise.
+         */
+        [[nodiscard]] bool isZero() const { return mantissa.empty(); }
+
+        /**
+         * @brief Checks whether the number is written without a decimal point.
+         * @return True if the number is an integer literal, false otherwise.
+         */
+        [[nodiscard]] bool isInteger() const { return exponent >= 0; }
+    };
+
+    /**
+     * @struct SmallDecimal
+     * @brief A signed decimal number whose mantissa fits in 64 bits, equal to (-1)^negative * mantissa * 10^exponent.
+     *
+     * @details Behaves exactly like BigDecimal, but needs no allocation. Arithmetic on it is done in native integers,
+     * and reports overflow so that the caller can redo it with BigDecimal.
+     */
+    struct SmallDecimal
+    {
+        /// @brief The digits of the number.
+        std::uint64_t mantissa = 0;
+
+        /// @brief The power of ten the mantissa is multiplied by.
+        long long exponent = 0;
+
+        /// @brief Whether the number is negative.
+        bool negative = false;
+
+        /**
+         * @brief Checks whether the number is zero.
+         * @return True if the number is zero, false otherwise.
+         */
+        [[nodiscard]] bool isZero() const { return mantissa == 0; }
+    };
+
+    /**
+     * @brief Removes the leading zero limbs of a magnitude.
+     * @param[in,out] a The magnitude to trim.
+     */
+    void trim(Limbs& a);
+
+    /**
+     * @brief Compares the magnitudes of two numbers.
+     *
+     * @param[in] a The first magnitude.
+     * @param[in] b The second magnitude.
+     * @return The ordering of a relative to b.
+     */
+    std::strong_ordering compareMagnitude(const Limbs& a, const Limbs& b);
+
+    /**
+     * @brief Adds two magnitudes.
+     *
+     * @param[in] a The first magnitude.
+     * @param[in] b The second magnitude.
+     * @return The sum of the magnitudes.
+     */
+    Limbs addMagnitude(const Limbs& a, const Limbs& b);
+
+    /**
+     * @brief Subtracts a smaller magnitude from a larger one.
+     * @note The first magnitude must not be smaller than the second one.
+     *
+     * @param[in] a The larger magnitude.
+     * @param[in] b The smaller magnitude.
+     * @return The difference of the magnitudes.
+     */
+    Limbs subtractMagnitude(const Limbs& a, const Limbs& b);
+
+    /**
+     * @struct MultiplyThresholds
+     * @brief Operand sizes, in limbs, at which multiplyMagnitude switches to a faster method.
+     * @details The values can be tuned at runtime, even while other threads are multiplying.
+     */
+    struct MultiplyThresholds
+    {
+        /// @brief Operands with at least this many limbs are multiplied with Karatsuba's method.
+        std::atomic<size_t> karatsuba = 48;
+
+        /// @brief Operands with at least this many limbs are multiplied with the Toom-3 method.
+        std::atomic<size_t> toom3 = 400;
+
+        /// @brief Operands with at least this many limbs are multiplied with the number-theoretic transform.
+        std::atomic<size_t> ntt = 800;
+
+        /// @brief Whether to verify every NTT product modulo a random prime.
+        std::atomic<bool> selfCheck = false;
+    };
+
+    /**
+     * @brief Gets the thresholds used to pick a multiplication method.
+     * @return A reference to the global thresholds, which may be modified.
+     */
+    MultiplyThresholds& multiplyThresholds();
+
+    /**
+     * @brief Multiplies two magnitudes, choosing the fastest method for their sizes.
+     * @details Small operands use the schoolbook method, larger ones Karatsuba, Toom-3 and finally the
+     * number-theoretic transform. Unbalanced operands are split into balanced pieces first.
+     *
+     * @param[in] a The first magnitude.
+     * @param[in] b The second magnitude.
+     * @return The product of the magnitudes.
+     */
+    Limbs multiplyMagnitude(const Limbs& a, const Limbs& b);
+
+    /**
+     * @brief Multiplies two magnitudes with the schoolbook method. Takes O(n*m) time.
+     *
+     * @param[in] a The first magnitude.
+     * @param[in] b The second magnitude.
+     * @return The product of the magnitudes.
+     */
+    Limbs multiplySchoolbook(const Limbs& a, const Limbs& b);
+
+    /**
+     * @brief Multiplies two magnitudes with Karatsuba's method. Takes O(n^1.585) time.
+     *
+     * @param[in] a The first magnitude.
+     * @param[in] b The second magnitude.
+     * @return The product of the magnitudes.
+     */
+    Limbs multiplyKaratsuba(const Limbs& a, const Limbs& b);
+
+    /**
+     * @brief Multiplies two magnitudes with the Toom-3 method. Takes O(n^1.465) time.
+     *
+     * @param[in] a The first magnitude.
+     * @param[in] b The second magnitude.
+     * @return The product of the magnitudes.
+     */
+    Limbs multiplyToom3(const Limbs& a, const Limbs& b);
+
+    /**
+     * @brief Multiplies two magnitudes with a number-theoretic transform. Takes O(n log n) time.
+     * @details The convolution is done modulo three NTT-friendly primes and reconstructed exactly with the Chinese
+     * remainder theorem, so no floating point is involved. If MultiplyThresholds::selfCheck is set, the product is
+     * verified modulo a random prime, and recomputed with Toom-3 if the check fails.
+     *
+     * @param[in] a The first magnitude.
+     * @param[in] b The second magnitude.
+     * @return The product of the magnitudes.
+     */
+    Limbs multiplyNTT(const Limbs& a, const Limbs& b);
+
+    /// @brief Divisors and quotients with at least this many limbs are divided with Newton's method.
+    constexpr size_t NEWTON_DIVISION_THRESHOLD = 500;
+
+    /**
+     * @struct LimbQuotientRemainder
+     * @brief The quotient and remainder of dividing two magnitudes.
+     */
+    struct LimbQuotientRemainder
+    {
+        Limbs quotient; ///< The quotient, rounded towards zero.
+        Limbs remainder; ///< The remainder.
+    };
+
+    /**
+     * @brief Divides two magnitudes, choosing the fastest method for their sizes.
+     *
+     * @param[in] a The dividend.
+     * @param[in] b The divisor, must not be zero.
+     * @return The quotient and remainder.
+     */
+    LimbQuotientRemainder divideMagnitude(const Limbs& a, const Limbs& b);
+
+    /**
+     * @brief Divides two magnitudes with Knuth's algorithm D. Takes O(n*m) time.
+     *
+     * @param[in] a The dividend.
+     * @param[in] b The divisor, must not be zero.
+     * @return The quotient and remainder.
+     */
+    LimbQuotientRemainder divideKnuth(const Limbs& a, const Limbs& b);
+
+    /**
+     * @brief Divides two magnitudes by multiplying with a reciprocal found by Newton's iteration.
+     * @details The reciprocal is computed with doubling precision, so a division costs a few multiplications.
+     *
+     * @param[in] a The dividend.
+     * @param[in] b The divisor, must not be zero.
+     * @return The quotient and remainder.
+     */
+    LimbQuotientRemainder divideNewton(const Limbs& a, const Limbs& b);
+
+    /// @brief Smaller magnitudes with at least this many limbs are reduced with Lehmer's algorithm.
+    constexpr size_t LEHMER_GCD_THRESHOLD = 4;
+
+    /**
+     * @brief Finds the greatest common divisor of two magnitudes, choosing the fastest method for their sizes.
+     * @details Lehmer's algorithm shrinks large magnitudes, binary GCD takes over for medium ones, and the last
+     * words are done natively.
+     *
+     * @param[in] a The first magnitude.
+     * @param[in] b The second magnitude.
+     * @return gcd(a, b), or the other magnitude if one is zero.
+     */
+    Limbs gcdMagnitude(const Limbs& a, const Limbs& b);
+
+    /**
+     * @brief Finds the greatest common divisor of two magnitudes with Stein's binary algorithm.
+     * @details Only halvings and subtractions are needed, but every step removes just a few bits. Takes O(n^2) time.
+     *
+     * @param[in] a The first magnitude.
+     * @param[in] b The second magnitude.
+     * @return gcd(a, b), or the other magnitude if one is zero.
+     */
+    Limbs gcdBinary(const Limbs& a, const Limbs& b);
+
+    /**
+     * @brief Finds the greatest common divisor of two magnitudes with Lehmer's algorithm.
+     * @details The Euclidean algorithm is run on the leading digits, and its steps are applied to the full magnitudes
+     * in one pass, so each pass removes about a limb. Takes O(n^2) time.
+     *
+     * @param[in] a The first magnitude.
+     * @param[in] b The second magnitude.
+     * @return gcd(a, b), or the other magnitude if one is zero.
+     */
+    Limbs gcdLehmer(const Limbs& a, const Limbs& b);
+
+    /**
+     * @brief Finds the greatest common divisor of two numbers.
+     * @details For decimals, this is the largest number that divides both into integers, e.g., gcd(1.5, 2.25) = 0.75.
+     *
+     * @param[in] a The first number. Its sign is ignored.
+     * @param[in] b The second number. Its sign is ignored.
+     * @return gcd(a, b), which is never negative.
+     */
+    BigDecimal gcd(const BigDecimal& a, const BigDecimal& b);
+
+    /// @brief Conversions between bases split the number until the pieces have at most this many chunks of digits.
+    constexpr size_t RADIX_CONVERSION_THRESHOLD = 32;
+
+    /**
+     * @brief Writes a magnitude in another base.
+     * @details The magnitude is split recursively by the powers chunk^(2^k), where a chunk is the largest power of the
+     * base that fits in a limb. The powers are cached for each base. With Newton division, this takes
+     * O(M(n) log n) time instead of O(n^2). For bases that are powers of two, the numerals are read from the bits of
+     * each chunk.
+     *
+     * @param[in] a The magnitude.
+     * @param[in] base The base, from 2 to 36.
+     * @return The numerals, using A-Z for the values 10 to 35.
+     */
+    std::string toBase(const Limbs& a, unsigned base);
+
+    /**
+     * @brief Reads a magnitude written in another base.
+     * @details The numerals are grouped into chunks, which are joined recursively by multiplying with the cached powers
+     * chunk^(2^k). Small groups of chunks are joined with Horner's scheme.
+     *
+     * @param[in] digits The numerals. Letters of either case stand for the values 10 to 35.
+     * @param[in] base The base, from 2 to 36.
+     * @param[out] out The magnitude.
+     * @return False if there are no numerals, or one of them is not less than the base.
+     */
+    bool fromBase(std::string_view digits, unsigned base, Limbs& out);
+
+    /**
+     * @brief Multiplies a magnitude by a single limb and adds another limb to it, in place.
+     *
+     * @param[in,out] a The magnitude to multiply.
+     * @param[in] factor The factor to multiply by.
+     * @param[in] addend The value to add after multiplying.
+     */
+    void multiplySmall(Limbs& a, Limb factor, Limb addend = 0);
+
+    /**
+     * @brief Divides a magnitude by a single limb, in place.
+     *
+     * @param[in,out] a The magnitude to divide. Holds the quotient afterwards.
+     * @param[in] divisor The divisor, must not be zero.
+     * @return The remainder of the division.
+     */
+    Limb divideSmall(Limbs& a, Limb divisor);
+
+    /**
+     * @brief Multiplies a magnitude by a power of ten.
+     *
+     * @param[in] a The magnitude to multiply.
+     * @param[in] digits The exponent of the power of ten.
+     * @return The magnitude multiplied by 10^digits.
+     */
+    Limbs shiftLeftDigits(const Limbs& a, long long digits);
+
+    /**
+     * @brief Counts the decimal digits of a magnitude.
+     *
+     * @param[in] a The magnitude.
+     * @return The number of decimal digits, 0 for zero.
+     */
+    long long countDigits(const Limbs& a);
+
+    /**
+     * @brief Counts the trailing zero decimal digits of a magnitude.
+     *
+     * @param[in] a The magnitude, which must not be zero.
+     * @return The number of trailing zeros.
+     */
+    long long countTrailingZeros(const Limbs& a);
+
+    /**
+     * @brief Parses a decimal number string.
+     * @details Accepts any number of leading signs, followed by digits with an optional decimal point.
+     *
+     * @param[in] string The string to parse.
+     * @param[out] out The parsed number.
+     * @return True if the string is a valid number, false otherwise.
+     */
+    bool parse(std::string_view string, BigDecimal& out);
+
+    /**
+     * @brief Converts a number back to its decimal string form.
+     *
+     * @param[in] number The number to convert.
+     * @return The number as a string, with as many decimal places as its exponent specifies.
+     */
+    std::string toString(const BigDecimal& number);
+
+    /**
+     * @brief Converts a native integer to a number.
+     *
+     * @param[in] value The value to convert.
+     * @return The converted number.
+     */
+    template<std::integral IntT>
+    BigDecimal fromInteger(const IntT value)
+    {
+        BigDecimal result;
+        unsigned long long magnitude = 0;
+        if constexpr (std::is_signed_v<IntT>)
+        {
+            result.negative = value < 0;
+            magnitude = result.negative ? 0ULL - static_cast<unsigned long long>(value) :
+                                          static_cast<unsigned long long>(value);
+        }
+        else
+            magnitude = value;
+
+        while (magnitude != 0)
+        {
+            result.mantissa.push_back(static_cast<Limb>(magnitude % LIMB_BASE));
+            magnitude /= LIMB_BASE;
+        }
+        return result;
+    }
+
+    /**
+     * @brief Changes the exponent of a number to a smaller one, without changing its value.
+     *
+     * @param[in,out] number The number to rescale.
+     * @param[in] exponent The new exponent. Must not be greater than the current one.
+     */
+    void rescale(BigDecimal& number, long long exponent);
+
+    /**
+     * @brief Removes trailing zeros after the decimal point.
+     * @details The exponent is never raised above 0, so integers stay integers.
+     *
+     * @param[in,out] number The number to process.
+     */
+    void stripTrailingZeros(BigDecimal& number);
+
+    /**
+     * @brief Compares two numbers without allocating, even if they have different exponents.
+     *
+     * @param[in] a The first number.
+     * @param[in] b The second number.
+     * @return The ordering of a relative to b.
+     */
+    std::strong_ordering compare(const BigDecimal& a, const BigDecimal& b);
+
+    /**
+     * @brief Compares two decimal strings directly by their signs, lengths and digits, without allocating.
+     *
+     * @param[in] a The first number.
+     * @param[in] b The second number.
+     * @return The ordering of a relative to b, or unordered if either string is not a number.
+     */
+    std::partial_ordering compare(std::string_view a, std::string_view b);
+
+    /**
+     * @brief Adds two numbers exactly.
+     *
+     * @param[in] a The first number.
+     * @param[in] b The second number.
+     * @return The sum, with the smaller exponent of the two operands.
+     */
+    BigDecimal add(const BigDecimal& a, const BigDecimal& b);
+
+    /**
+     * @brief Subtracts two numbers exactly.
+     *
+     * @param[in] a The number to subtract from.
+     * @param[in] b The number to subtract.
+     * @return The difference, with the smaller exponent of the two operands.
+     */
+    BigDecimal subtract(const BigDecimal& a, const BigDecimal& b);
+
+    /**
+     * @brief Multiplies two numbers exactly.
+     *
+     * @param[in] a The first number.
+     * @param[in] b The second number.
+     * @return The product, whose exponent is the sum of the operands' exponents.
+     */
+    BigDecimal multiply(const BigDecimal& a, const BigDecimal& b);
+
+    /**
+     * @brief Rounds a number off to a fixed number of decimal places, half away from zero.
+     * @details Behaves like numUtils::roundOff: integers are left as-is, and decimals are padded or rounded so that
+     * exactly `decimals` digits follow the decimal point.
+     *
+     * @param[in] number The number to round.
+     * @param[in] decimals The number of decimal places to keep.
+     * @return The rounded number.
+     */
+    BigDecimal roundOff(const BigDecimal& number, long long decimals);
+
+    /**
+     * @brief Converts a number to the nearest double, for seeding iterations.
+     *
+     * @param[in] number The number.
+     * @return The approximate value of the number.
+     */
+    double toDouble(const BigDecimal& number);
+
+    /**
+     * @brief Divides two numbers, truncating the quotient towards zero.
+     *
+     * @param[in] a The dividend.
+     * @param[in] b The divisor, must not be zero.
+     * @param[in] decimals The number of decimal places of the quotient.
+     * @return The quotient, with exactly `decimals` decimal places.
+     */
+    BigDecimal divideTruncated(const BigDecimal& a, const BigDecimal& b, long long decimals);
+
+    /**
+     * @brief Divides two numbers and rounds the quotient the same way calc::divide does.
+     * @details The quotient is rounded half away from zero to `decimals` places. If it is smaller than 10^-decimals it
+     * becomes 0, and with 0 decimals it is truncated.
+     *
+     * @param[in] a The dividend.
+     * @param[in] b The divisor, must not be zero.
+     * @param[in] decimals The number of decimal places of the quotient.
+     * @return The rounded quotient.
+     */
+    BigDecimal divideRounded(const BigDecimal& a, const BigDecimal& b, long long decimals);
+
+    /**
+     * @brief Parses a decimal string into a small number.
+     *
+     * @param[in] string The string to parse, accepting the same forms as parse() for BigDecimal.
+     * @param[out] out The parsed number.
+     * @return True if the string is a number and its digits fit in 64 bits, false otherwise.
+     */
+    bool parse(std::string_view string, SmallDecimal& out);
+
+    /**
+     * @brief Converts a number to a small number, if its mantissa fits in 64 bits.
+     *
+     * @param[in] number The number to convert.
+     * @param[out] out The converted number.
+     * @return True if the number fits, false otherwise.
+     */
+    bool narrow(const BigDecimal& number, SmallDecimal& out);
+
+    /**
+     * @brief Converts a number to a native integer, if it is an integer that fits in a long long.
+     *
+     * @param[in] number The number to convert.
+     * @param[out] out The converted number.
+     * @return True if the number is such an integer, false otherwise.
+     */
+    bool toInteger(const BigDecimal& number, long long& out);
+
+    /**
+     * @brief Converts a small number to limbs.
+     *
+     * @param[in] number The number to convert.
+     * @return The converted number.
+     */
+    BigDecimal widen(const SmallDecimal& number);
+
+    /**
+     * @brief Converts a small number to a decimal string, the same way as toString() for BigDecimal.
+     *
+     * @param[in] number The number to convert.
+     * @return The string representation of the number.
+     */
+    std::string toString(const SmallDecimal& number);
+
+    /**
+     * @brief Removes trailing zeros after the decimal point, without moving the exponent above zero.
+     * @param[in,out] number The number to process.
+     */
+    void stripTrailingZeros(SmallDecimal& number);
+
+    /**
+     * @brief Compares two small numbers.
+     *
+     * @param[in] a The first number.
+     * @param[in] b The second number.
+     * @return The ordering of a relative to b.
+     */
+    std::strong_ordering compare(const SmallDecimal& a, const SmallDecimal& b);
+
+    /**
+     * @brief Adds two small numbers exactly.
+     *
+     * @param[in] a The first number.
+     * @param[in] b The second number.
+     * @param[out] out The sum.
+     * @return True if the sum fits, false otherwise.
+     */
+    bool add(const SmallDecimal& a, const SmallDecimal& b, SmallDecimal& out);
+
+    /**
+     * @brief Subtracts two small numbers exactly.
+     *
+     * @param[in] a The number to subtract from.
+     * @param[in] b The number to subtract.
+     * @param[out] out The difference.
+     * @return True if the difference fits, false otherwise.
+     */
+    bool subtract(const SmallDecimal& a, const SmallDecimal& b, SmallDecimal& out);
+
+    /**
+     * @brief Multiplies two small numbers, drops the trailing zeros after the decimal point and rounds the product
+     * with roundOff().
+     * @details The product is kept in a double-width integer, so it only has to fit after rounding.
+     *
+     * @param[in] a The first number.
+     * @param[in] b The second number.
+     * @param[in] decimals The number of decimal places to keep.
+     * @param[out] out The rounded product.
+     * @return True if the rounded product fits, false otherwise.
+     */
+    bool multiply(const SmallDecimal& a, const SmallDecimal& b, long long decimals, SmallDecimal& out);
+
+    /**
+     * @brief Rounds a small number off to a fixed number of decimal places, like roundOff() for BigDecimal.
+     *
+     * @param[in] number The number to round.
+     * @param[in] decimals The number of decimal places to keep.
+     * @param[out] out The rounded number.
+     * @return True if the rounded number fits, false otherwise.
+     */
+    bool roundOff(const SmallDecimal& number, long long decimals, SmallDecimal& out);
+
+    /**
+     * @brief Divides two small numbers and rounds the quotient like divideRounded() for BigDecimal.
+     *
+     * @param[in] a The dividend.
+     * @param[in] b The divisor, must not be zero.
+     * @param[in] decimals The number of decimal places of the quotient.
+     * @param[out] out The rounded quotient.
+     * @return True if the division could be done in double-width integers, false otherwise.
+     */
+    bool divideRounded(const SmallDecimal& a, const SmallDecimal& b, long long decimals, SmallDecimal& out);
+
+    /**
+     * @struct HypergeometricSeries
+     * @brief A series whose k-th term is a(k) / b(k) * p(0) / q(0) * ... * p(k) / q(k), with integer factors.
+     * @details Every factor is an integer-valued BigDecimal. Leaving a or b empty means the factor is always 1.
+     */
+    struct HypergeometricSeries
+    {
+        std::function<BigDecimal(long long)> a; ///< The numerator of the factor only applied to the k-th term.
+        std::function<BigDecimal(long long)> b; ///< The denominator of the factor only applied to the k-th term.
+        std::function<BigDecimal(long long)> p; ///< The numerator of the ratio between consecutive terms.
+        std::function<BigDecimal(long long)> q; ///< The denominator of the ratio between consecutive terms.
+    };
+
+    /**
+     * @brief Sums the first terms of a hypergeometric series by binary splitting.
+     * @details The terms are combined pairwise into exact integers, so the whole sum takes a single division at the
+     * end. This costs O(M(n) log^2 n) instead of one full-precision division per term.
+     *
+     * @param[in] series The series to sum.
+     * @param[in] terms The number of terms to sum.
+     * @param[in] decimals The number of decimal places of the result.
+     * @return The sum, truncated to `decimals` places.
+     */
+    BigDecimal sumSeries(const HypergeometricSeries& series, long long terms, long long decimals);
+
+    /**
+     * @struct DigitGroup
+     * @brief A group of decimal places of a number, worth numerator / 10^end.
+     */
+    struct DigitGroup
+    {
+        BigDecimal numerator; ///< The digits of the group, as an integer.
+        long long end = 0; ///< The decimal place after the last digit of the group.
+    };
+
+    /**
+     * @brief Splits the decimal places of a number into groups of doubling length, for bit-burst evaluation.
+     * @details x = x0 + x1 + ..., where x0 holds the first two decimal places, x1 the next two, x2 the next four and
+     * so on. A Taylor series of xi has a numerator as long as xi, but converges faster the further xi is from the
+     * decimal point, so summing every group by binary splitting costs about the same.
+     *
+     * @param[in] x The number, |x| < 1. Its sign is ignored.
+     * @param[in] decimals The number of decimal places to split.
+     * @return The groups that are not zero.
+     */
+    std::vector<DigitGroup> splitDigitGroups(const BigDecimal& x, long long decimals);
+
+    /**
+     * @brief Counts the powers of a digit group needed by a Taylor series with factorial denominators.
+     *
+     * @param[in] group The digit group.
+     * @param[in] decimals The number of decimal places of the sum.
+     * @return The power n at which group^n / n! falls below 10^-decimals.
+     */
+    long long taylorTerms(const DigitGroup& group, long long decimals);
+
+    /**
+     * @brief Raises a number to a non-negative integer power by repeated squaring.
+     * @details The exponent is read from left to right with a sliding window over its bits, so that a run of bits costs
+     * one multiplication by a precalculated odd power.
+     *
+     * @param[in] base The base.
+     * @param[in] exponent The exponent.
+     * @return base^exponent, exactly.
+     */
+    BigDecimal power(const BigDecimal& base, unsigned long long exponent);
+
+    /**
+     * @brief Raises a number to an integer power. A negative power takes a single reciprocal at the end.
+     *
+     * @param[in] base The base, must not be zero if the exponent is negative.
+     * @param[in] exponent The exponent.
+     * @param[in] decimals The number of decimal places of the result.
+     * @return base^exponent, rounded off to `decimals` places.
+     */
+    BigDecimal power(const BigDecimal& base, long long exponent, long long decimals);
+
+    /**
+     * @brief Calculates e^x.
+     * @details x is reduced to k * ln(2) + r with 0 <= r < ln(2). exp(r) is the product of the series of r's digit
+     * groups, each summed by binary splitting, and the result is scaled by 2^k.
+     *
+     * @param[in] x The exponent.
+     * @param[in] decimals The number of decimal places of the result.
+     * @return e^x, rounded to `decimals` places.
+     */
+    BigDecimal exp(const BigDecimal& x, long long decimals);
+
+    /**
+     * @brief Calculates pi with the Chudnovsky series. The most precise value so far is cached.
+     *
+     * @param[in] decimals The number of decimal places of the result.
+     * @return Pi, rounded to `decimals` places.
+     */
+    BigDecimal pi(long long decimals);
+
+    /**
+     * @brief Calculates e, the base of the natural logarithm. The most precise value so far is cached.
+     *
+     * @param[in] decimals The number of decimal places of the result.
+     * @return e, rounded to `decimals` places.
+     */
+    BigDecimal e(long long decimals);
+
+    /**
+     * @brief Calculates ln(2). The most precise value so far is cached.
+     *
+     * @param[in] decimals The number of decimal places of the result.
+     * @return ln(2), rounded to `decimals` places.
+     */
+    BigDecimal ln2(long long decimals);
+
+    /**
+     * @brief Calculates ln(10). The most precise value so far is cached.
+     *
+     * @param[in] decimals The number of decimal places of the result.
+     * @return ln(10), rounded to `decimals` places.
+     */
+    BigDecimal ln10(long long decimals);
+
+    /**
+     * @brief Calculates the integer square root of a magnitude.
+     *
+     * @param[in] a The magnitude.
+     * @return floor(sqrt(a)).
+     */
+    Limbs squareRootMagnitude(const Limbs& a);
+
+    /**
+     * @brief Calculates the square root of a number.
+     * @details 1 / sqrt(x) is refined with Newton's iteration, which needs no division, doubling the precision with
+     * each step. The last digit is then corrected exactly.
+     *
+     * @param[in] x The number, must not be negative.
+     * @param[in] decimals The number of decimal places of the result.
+     * @return The square root, truncated to `decimals` places.
+     */
+    BigDecimal squareRoot(const BigDecimal& x, long long decimals);
+
+    /**
+     * @brief Calculates the n-th root of a number.
+     * @details Square roots are passed to squareRoot. Other roots are refined with Newton's iteration from a double
+     * estimate, doubling the precision with each step, and the last digit is then corrected exactly.
+     *
+     * @param[in] x The number, must not be negative.
+     * @param[in] n The index of the root, must be positive.
+     * @param[in] decimals The number of decimal places of the result.
+     * @return The n-th root, truncated to `decimals` places.
+     */
+    BigDecimal nthRoot(const BigDecimal& x, unsigned long long n, long long decimals);
+
+    /// @brief Logarithms with at least this many working decimal places are calculated with the AGM. Below it, Newton's
+    /// method on the binary-splitting exp is faster.
+    constexpr long long AGM_LOG_THRESHOLD = 100000;
+
+    /**
+     * @brief Calculates ln(x) with Halley's iteration on exp, tripling the precision with each step.
+     *
+     * @param[in] x The number, 1 <= x < 10.
+     * @param[in] decimals The number of decimal places of the result.
+     * @return ln(x) to `decimals` places, correct to about a unit in the last place.
+     */
+    BigDecimal lnNewton(const BigDecimal& x, long long decimals);
+
+    /**
+     * @brief Calculates ln(x) with the arithmetic-geometric mean.
+     * @details ln(s) = pi / (2 AGM(1, 4 / s)) for large s, so x is scaled by 2^m first and m ln(2) is subtracted.
+     *
+     * @param[in] x The number, 1 <= x < 10.
+     * @param[in] decimals The number of decimal places of the result.
+     * @return ln(x) to `decimals` places, correct to about a unit in the last place.
+     */
+    BigDecimal lnAGM(const BigDecimal& x, long long decimals);
+
+    /**
+     * @brief Calculates ln(x).
+     * @details x = m * 10^k with 1 <= m < 10, so ln(x) = ln(m) + k ln(10). ln(m) is calculated with Newton's
+     * method at low precision and with the AGM at high precision.
+     *
+     * @param[in] x The number, must be positive.
+     * @param[in] decimals The number of decimal places of the result.
+     * @return ln(x), rounded to `decimals` places.
+     */
+    BigDecimal ln(const BigDecimal& x, long long decimals);
+
+    /**
+     * @struct SineCosine
+     * @brief The sine and cosine of an angle.
+     */
+    struct SineCosine
+    {
+        BigDecimal sine; ///< The sine.
+        BigDecimal cosine; ///< The cosine.
+    };
+
+    /**
+     * @brief Calculates the sine and cosine of an angle with a single argument reduction.
+     * @details x is reduced to q * (pi / 2) + r with |r| <= pi / 4, against the cached pi with a place for every digit
+     * of q. Angles in degrees or grads are reduced exactly by their right angle instead. sin(r) and cos(r) are built
+     * from the series of r's digit groups, and the quadrant of q rotates them.
+     *
+     * @param[in] x The angle.
+     * @param[in] decimals The number of decimal places of the result.
+     * @param[in] rightAngle The size of a right angle in the unit of x, such as 90 for degrees, or 0 for radians.
+     * @return The sine and cosine, rounded to `decimals` places.
+     */
+    SineCosine sincos(const BigDecimal& x, long long decimals, long long rightAngle = 0);
+
+    /**
+     * @brief Calculates the angle of the point (x, y), in radians.
+     * @details Seeded with std::atan2, every step t + (y cos t - x sin t) / (x cos t + y sin t) triples the number of
+     * correct digits.
+     *
+     * @param[in] y The y coordinate.
+     * @param[in] x The x coordinate. x and y must not both be zero.
+     * @param[in] decimals The number of decimal places of the result.
+     * @return The angle in (-pi, pi], rounded to `decimals` places.
+     */
+    BigDecimal atan2(const BigDecimal& y, const BigDecimal& x, long long decimals);
+
+    /**
+     * @brief Lists the primes up to a number with the sieve of Eratosthenes.
+     *
+     * @param[in] n The upper bound.
+     * @return The primes that are not greater than n, in ascending order.
+     */
+    std::vector<std::uint64_t> primesUpTo(unsigned long long n);
+
+    /**
+     * @brief Multiplies a list of integers as a balanced tree.
+     * @details Neighbouring products are multiplied pairwise, so the operands at every level are about the same size
+     * and large products go to the subquadratic methods.
+     *
+     * @param[in] factors The factors.
+     * @return The product of the factors, or 1 if there are none.
+     */
+    BigDecimal productTree(const std::vector<std::uint64_t>& factors);
+
+    /**
+     * @brief Calculates a factorial with Luschny's prime-swing method.
+     * @details n! = (floor(n / 2)!)^2 * swing(n), where the swinging factorial is assembled from its prime
+     * factorization with a product tree.
+     *
+     * @param[in] n The number.
+     * @return n!.
+     */
+    BigDecimal factorial(unsigned long long n);
+
+    /**
+     * @brief Calculates a binomial coefficient.
+     * @details Small k multiply the k largest factors of n! with a product tree and divide by k! once. Otherwise the
+     * coefficient is assembled from its prime factorization.
+     *
+     * @param[in] n The number of items.
+     * @param[in] k The number of items chosen.
+     * @return n! / (k! (n - k)!), or 0 if k > n.
+     */
+    BigDecimal binomial(unsigned long long n, unsigned long long k);
+
+    /**
+     * @struct PrimePower
+     * @brief A prime factor of a number and its multiplicity.
+     */
+    struct PrimePower
+    {
+        BigDecimal prime; ///< The prime.
+        unsigned long long exponent = 0; ///< The number of times the prime divides the number.
+    };
+
+    /**
+     * @brief Checks whether an integer is prime.
+     * @details Primes up to 2^15 are divided out first. Miller-Rabin with the first thirteen prime bases follows,
+     * which is exact below 3.3 * 10^24 and a probable-prime test above.
+     *
+     * @param[in] n The number.
+     * @return True if n is prime, false if it is not, or not a positive integer.
+     */
+    bool isPrime(const BigDecimal& n);
+
+    /**
+     * @brief Factorizes an integer.
+     * @details Small primes are found by trial division. The cofactor is split with Brent's variant of Pollard's rho
+     * until Miller-Rabin finds every part prime. Factors that fit in 64 bits are handled in native integers.
+     *
+     * @param[in] n The number, an integer. Its sign is ignored.
+     * @return The prime factors of |n| in ascending order, or none for 0 and 1.
+     */
+    std::vector<PrimePower> factorize(const BigDecimal& n);
+
+    /// @brief The primes for multi-modular arithmetic are below 2^MODULAR_PRIME_BITS, so that the sum of two residues
+    /// fits in a native word.
+    constexpr int MODULAR_PRIME_BITS = 62;
+
+    /**
+     * @brief Lists the largest primes below 2^MODULAR_PRIME_BITS, for multi-modular arithmetic.
+     * @details The primes are found with Miller-Rabin once, and shared by the whole program.
+     *
+     * @param[in] count The number of primes.
+     * @return The `count` largest primes below 2^MODULAR_PRIME_BITS, in descending order.
+     */
+    std::vector<std::uint64_t> modularPrimes(size_t count);
+
+    /**
+     * @brief Calculates a magnitude modulo a native integer.
+     *
+     * @param[in] a The magnitude.
+     * @param[in] m The modulus, less than 2^MODULAR_PRIME_BITS.
+     * @return a mod m.
+     */
+    std::uint64_t remainderWord(const Limbs& a, std::uint64_t m);
+
+    /**
+     * @brief Reconstructs an integer from its residues modulo distinct primes, with the Chinese remainder theorem.
+     * @details Garner's algorithm finds the mixed-radix digits of the integer in native arithmetic, and Horner's scheme
+     * assembles them.
+     *
+     * @param[in] residues The residues of the integer modulo each prime.
+     * @param[in] primes The primes, less than 2^MODULAR_PRIME_BITS.
+     * @return The integer x, where |x| is less than half the product of the primes.
+     */
+    BigDecimal chineseRemainder(const std::vector<std::uint64_t>& residues, const std::vector<std::uint64_t>& primes);
+} // namespace steppable::__internals::bignum
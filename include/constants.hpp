@@ -27,63 +27,41 @@
 /**
  * @namespace steppable::constants
  * @brief Numerical constants used in Steppable.
+ * @note These are fixed to 100 decimal places. The limb-based backend calculates pi, e, ln(2) and ln(10) to any
+ * precision, see steppable::__internals::bignum::pi.
  */
 namespace steppable::constants
 {
+    // The multiples were generated with Python's decimal module from 120 digits of pi, passed as a string rather than
+    // a float literal, which would only be correct to about 16 digits:
+    // -------------------------------------------------------
+    // 1 | from decimal import Decimal, getcontext
+    // 2 | getcontext().prec = 130
+    // 3 | pi = Decimal("3.14159265358979323846...")  # 120 digits
+    // 4 | (pi / 180).quantize(Decimal("1e-100"))
+    // -------------------------------------------------------
+
     /// @brief 100 digits of pi.
     constexpr const std::string_view PI =
         "3.1415926535897932384626433832795028841971693993751058209749445923078164062862089986280348253421170679";
 
-    /// @brief Pi multiplied by 2.
-    // Generated using Python:
-    // -------------------------------------------------------
-    // 1 | from decimal import Decimal, getcontext
-    // 2 | # Set precision to 100 decimal places.
-    // 3 | getcontext().prec = 100
-    // 4 | Decimal(
-    // 5 |     3.1415926535897932384626433832795028841971693993751058209749445923078164062862089986280348253421170679
-    // 6 | ) * Decimal(2)
-    // -------------------------------------------------------
-    constexpr const std::string_view TWO_PI = "6.283185307179586231995926937088370323181152343750";
+    /// @brief Pi multiplied by 2, correct to 100 decimal places.
+    constexpr const std::string_view TWO_PI =
+        "6.2831853071795864769252867665590057683943387987502116419498891846156328125724179972560696506842341360";
 
-    /// @brief Pi divided by 2.
-    // Generated using Python:
-    // -------------------------------------------------------
-    // 1 | from decimal import Decimal, getcontext
-    // 2 | # Set precision to 100 decimal places.
-    // 3 | getcontext().prec = 100
-    // 4 | Decimal(
-    // 5 |     3.1415926535897932384626433832795028841971693993751058209749445923078164062862089986280348253421170679
-    // 6 | ) / Decimal(2)
-    // -------------------------------------------------------
+    /// @brief Pi divided by 2, correct to 100 decimal places.
     constexpr const std::string_view PI_OVER_2 =
-        "1.570796326794896619231321691639751442098584699687552910487472296153908203143104499314017412835292542";
+        "1.5707963267948966192313216916397514420985846996875529104874722961539082031431044993140174126710585340";
 
     /// @brief Pi divided by 180 (to convert degrees to radians), correct to 100 decimal places.
-    // Generated using Python:
-    // -------------------------------------------------------
-    // 1 | from decimal import Decimal, getcontext
-    // 2 | # Set precision to 100 decimal places.
-    // 3 | getcontext().prec = 100
-    // 4 | Decimal(
-    // 5 |     3.1415926535897932384626433832795028841971693993751058209749445923078164062862089986280348253421170679
-    // 6 | ) / Decimal(180)
-    // -------------------------------------------------------
     constexpr const std::string_view PI_OVER_180 =
-        "0.01745329251994329508887757482524547311994764539930555555555555555555555555555555555555555555555555556";
+        "0.0174532925199432957692369076848861271344287188854172545609719144017100911460344944368224156963450948";
 
     /// @brief Pi divided by 200 (to convert grads to radians), correct to 100 decimal places.
-    // Generated using Python:
-    // -------------------------------------------------------
-    // 1 | from decimal import Decimal, getcontext
-    // 2 | # Set precision to 100 decimal places.
-    // 3 | getcontext().prec = 100
-    // 4 | Decimal(
-    // 5 |     3.1415926535897932384626433832795028841971693993751058209749445923078164062862089986280348253421170679
-    // 6 | ) / Decimal(200)
-    // -------------------------------------------------------
     constexpr const std::string_view PI_OVER_200 =
-        "0.01570796326794896619231321691639716312084074699687552942986246296153903203140449499314017412671058534";
+        "0.0157079632679489661923132169163975144209858469968755291048747229615390820314310449931401741267105853";
 
-    constexpr const std::string_view E = "2.718281828459045090795598298427648842334747314453125";
+    /// @brief e, the base of the natural logarithm, correct to 100 decimal places.
+    constexpr const std::string_view E =
+        "2.7182818284590452353602874713526624977572470936999595749669676277240766303535475945713821785251664274";
 } // namespace steppable::constants
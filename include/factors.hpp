@@ -33,9 +33,10 @@ namespace steppable::__internals::numUtils
 {
     /**
      * @brief Get the factors of a number.
+     * @details The divisors are enumerated from the prime factorization of the number.
      *
      * @param[in] _number The number to get the factors of.
-     * @return The factors of the number.
+     * @return The factors of the number, in ascending order.
      */
     std::vector<std::string> getFactors(const std::string& _number);
 
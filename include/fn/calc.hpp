@@ -1,5 +1,5 @@
 /**************************************************************************************************
- * Copyright (c) 2023-2025 NWSOFT                                                                 *
+ * Copyright (c) 2023-2026 NWSOFT                                                                 *
  *                                                                                                *
  * Permission is hereby granted, free of charge, to any person obtaining a copy                   *
  * of this software and associated documentation files (the "Software"), to deal                  *
@@ -26,7 +26,7 @@
  *
  * The functions in this file perform various arithmetic operations on strings, such as absolute value,
  * addition, comparison, decimal conversion, division, multiplication, power, and subtraction.
- * Additionally, there is a template function for looping a specified number of times.
+ * Additionally, there are template functions for looping a specified number of times, sequentially or in parallel.
  *
  * @author Andy Zhang
  *
@@ -35,11 +35,17 @@
 
 #pragma once
 
+#include "bignum.hpp"
 #include "fn/root.hpp"
+#include "getString.hpp"
 #include "output.hpp"
 #include "steppable/number.hpp"
+#include "threadPool.hpp"
 #include "types/result.hpp"
 
+#include <algorithm>
+#include <concepts>
+#include <cstdint>
 #include <string>
 #include <util.hpp>
 
@@ -60,6 +66,15 @@ namespace steppable::__internals::calc
         std::string remainder;
     };
 
+    /**
+     * @brief Represents the sine and cosine of an angle.
+     */
+    struct SineCosine
+    {
+        std::string sine;
+        std::string cosine;
+    };
+
     /**
      * @brief Calculates the absolute value of a string representation of a number.
      *
@@ -242,6 +257,16 @@ namespace steppable::__internals::calc
      */
     std::string factorial(const std::string& _number, int steps = 2);
 
+    /**
+     * @brief Calculates the binomial coefficient n choose k.
+     *
+     * @param _n The number of items.
+     * @param _k The number of items chosen.
+     *
+     * @return The binomial coefficient, or 0 if k is greater than n.
+     */
+    std::string binomial(const std::string& _n, const std::string& _k);
+
     /**
      * @brief Converts degrees to radians.
      *
@@ -258,6 +283,17 @@ namespace steppable::__internals::calc
      */
     std::string gradToRad(const std::string& _grad);
 
+    /**
+     * @brief Calculates the sine and cosine of a number with a single argument reduction.
+     *
+     * @param x The number to calculate the sine and cosine of.
+     * @param decimals The number of decimal places to round off to.
+     * @param mode The mode to calculate them in. 0 = radians (default), 1 = degrees, 2 = gradians.
+     *
+     * @return The sine and cosine of the number.
+     */
+    SineCosine sincos(const std::string& x, int decimals, int mode = 0);
+
     /**
      * @brief Calculates the cosine of a number.
      *
@@ -553,8 +589,86 @@ namespace steppable::__internals::calc
      */
     std::string ln(const std::string& _number, size_t _decimals);
 
+    /**
+     * @struct LoopIndex
+     * @brief The index of an iteration of loop() or parallelLoop(), counting from 0.
+     * @details The index is kept as a native integer, and is only written out when it is converted to a string.
+     */
+    struct LoopIndex
+    {
+        std::uint64_t value = 0; ///< The index.
+
+        /**
+         * @brief Converts the index to a string.
+         * @return The index as a string.
+         */
+        // NOLINTNEXTLINE(*-explicit-constructor, *-explicit-conversions)
+        operator std::string() const { return std::to_string(value); }
+    };
+
+    /**
+     * @brief Calls a predicate, reporting the exception it throws instead of passing it on.
+     *
+     * @param[in] predicate The predicate function to call.
+     * @param[in] index The index of the iteration.
+     */
+    template<typename Pred, typename Index>
+    void callLoopPredicate(Pred& predicate, const Index& index)
+    {
+        try
+        {
+            predicate(index);
+        }
+        catch (std::exception& e)
+        {
+            output::error("loop", localization::$("loop", "c3732b3b-bce2-4ecb-a6b2-d55e70c76df7"));
+            output::error("loop", localization::$("loop", "15b2377d-1755-4e5e-ad39-229718a13c7c", { e.what() }));
+        }
+    }
+
+    /**
+     * @enum LoopCount
+     * @brief Whether the number of iterations of a loop could be read.
+     */
+    enum class LoopCount : std::uint8_t
+    {
+        COUNTED, ///< The number of iterations fits in a native integer.
+        NOT_A_NUMBER, ///< The number of iterations is not a number, so the loop does not run.
+        TOO_LARGE, ///< The number of iterations does not fit in a native integer.
+    };
+
+    /**
+     * @brief Reads the number of iterations of a loop, if it fits in a native integer.
+     *
+     * @param[in] times The number of iterations. A decimal counts the integers below it, and a negative number is 0.
+     * @param[out] count The number of iterations. It is 0 unless the status is LoopCount::COUNTED.
+     * @return Whether the number of iterations could be read.
+     */
+    inline LoopCount loopCount(const std::string& times, std::uint64_t& count)
+    {
+        count = 0;
+        bignum::BigDecimal parsed;
+        if (not bignum::parse(times, parsed))
+            return LoopCount::NOT_A_NUMBER;
+        if (parsed.negative or parsed.isZero())
+            return LoopCount::COUNTED;
+
+        auto whole = bignum::divideTruncated(parsed, bignum::fromInteger(1), 0);
+        if (bignum::compare(whole, parsed) < 0)
+            whole = bignum::add(whole, bignum::fromInteger(1));
+        long long value = 0;
+        if (not bignum::toInteger(whole, value))
+            return LoopCount::TOO_LARGE;
+        count = static_cast<std::uint64_t>(value);
+        return LoopCount::COUNTED;
+    }
+
     /**
      * @brief Executes a given predicate function a specified number of times.
+     * @details The predicate receives the index of the iteration, counting from 0, as a LoopIndex. It converts to a
+     * string only when needed. If the number of iterations does not fit in a native integer, predicates that take a
+     * string are called with the index as a string instead. Other predicates are not called, and an error is reported.
+     * A `times` that is not a number means zero iterations.
      *
      * @param[in] times The number of times to execute the predicate function.
      * @param[in] predicate The predicate function to execute.
@@ -562,29 +676,59 @@ namespace steppable::__internals::calc
     template<typename Pred>
     void loop(const std::string& times, Pred predicate)
     {
-        // We're done already!
-        if (times == "0")
+        std::uint64_t count = 0;
+        const auto status = loopCount(times, count);
+        if (status == LoopCount::NOT_A_NUMBER)
             return;
-        if (times == "1")
-            return predicate("1");
-
-        std::string current = "0";
-        auto result = compare(current, times, 0);
+        if (status == LoopCount::COUNTED)
+        {
+            for (std::uint64_t i = 0; i < count; i++)
+                callLoopPredicate(predicate, LoopIndex{ i });
+            return;
+        }
 
-        while (result == "0")
+        if constexpr (std::invocable<Pred&, const std::string&>)
         {
-            try
-            {
-                predicate(current);
-            }
-            catch (std::exception& e)
+            std::string current = "0";
+            while (bignum::compare(current, times) < 0)
             {
-                output::error("loop", "Exception occurred in predicate."s);
-                output::error("loop", "Exception message: {0}"s, { e.what() });
+                callLoopPredicate(predicate, current);
+                current = add(current, "1", 0);
             }
-            current = add(current, "1", 0);
-            result = compare(current, times, 0);
         }
+        else
+            output::error("loop", localization::$("loop", "3474ed5e-2269-422f-bfa2-90138ebb3612", { times }));
     }
 
+    /**
+     * @brief Executes a given predicate function a specified number of times, on several threads.
+     * @details The range is split into a few chunks per thread, which are run on the shared thread pool. The
+     * iterations must not depend on each other, and the predicate must be safe to call from several threads at once.
+     * A `times` that is not a number means zero iterations. Numbers of iterations that do not fit in a native integer
+     * are handled like in loop(), on the calling thread.
+     *
+     * @param[in] times The number of times to execute the predicate function.
+     * @param[in] predicate The predicate function to execute.
+     */
+    template<typename Pred>
+    void parallelLoop(const std::string& times, Pred predicate)
+    {
+        std::uint64_t count = 0;
+        if (const auto status = loopCount(times, count); status == LoopCount::TOO_LARGE)
+            return loop(times, predicate);
+        if (count == 0)
+            return;
+
+        auto& pool = utils::ThreadPool::instance();
+        const auto chunks = static_cast<size_t>(std::min<std::uint64_t>(count, pool.concurrency() * 4));
+        const auto chunkSize = count / chunks;
+        const auto remainder = count % chunks;
+        pool.run(chunks, [&](const size_t chunk) {
+            // The first `remainder` chunks take one more iteration each.
+            const auto begin = (chunk * chunkSize) + std::min<std::uint64_t>(chunk, remainder);
+            const auto end = begin + chunkSize + (chunk < remainder ? 1 : 0);
+            for (auto i = begin; i < end; i++)
+                callLoopPredicate(predicate, LoopIndex{ i });
+        });
+    }
 } // namespace steppable::__internals::calc
@@ -88,7 +88,8 @@ namespace steppable
 
         /**
          * @brief Adds two fractions together.
-         * This function does it by doing a simple fraction addition and returns the sum.
+         * The denominators are reduced by their GCD first, so the sum is found in lowest terms without simplifying it
+         * again.
          *
          * @param[in] rhs The other fraction.
          * @return The sum of fractions.
@@ -104,7 +105,7 @@ namespace steppable
 
         /**
          * @brief Subtracts a fraction from another fraction.
-         * This function does it by doing a simple fraction subtraction and returns the difference.
+         * The denominators are reduced by their GCD first, like in addition.
          *
          * @param[in] rhs The other fraction.
          * @return The difference of fractions.
@@ -120,7 +121,7 @@ namespace steppable
 
         /**
          * @brief Multiplies two fractions together.
-         * This function does it by doing a simple fraction multiplication and returns the sum.
+         * The cross GCDs of each top component and the other bottom component are divided out before multiplying.
          *
          * @param[in] rhs The other fraction.
          * @return The product of fractions.
@@ -129,11 +130,11 @@ namespace steppable
 
         /**
          * @brief Divides a fraction by abother fraction.
-         * This function does it by doing a simple fraction division (multiply by inverse) and
-         * returns the sum.
+         * This function does it by multiplying by the reciprocal of the other fraction.
          *
          * @param[in] rhs The other fraction.
-         * @return The sum of fractions.
+         * @return The current fraction.
+         * @throws ZeroDenominatorException when the other fraction is zero.
          */
         Fraction operator/(const Fraction& rhs) const;
 
@@ -147,7 +148,8 @@ namespace steppable
 
         /**
          * @brief Adds two fractions together and stores the result in the current one.
-         * This function does it by doing a simple fraction addition and returns the sum.
+         * The denominators are reduced by their GCD first, so the sum is found in lowest terms without simplifying it
+         * again.
          *
          * @param[in] rhs The other fraction.
          * @return The current fraction.
@@ -156,7 +158,7 @@ namespace steppable
 
         /**
          * @brief Subtracts a fraction from another fraction and stores the result in the current one.
-         * This function does it by doing a simple fraction subtraction and returns the difference.
+         * The denominators are reduced by their GCD first, like in addition.
          *
          * @param[in] rhs The other fraction.
          * @return The current fraction.
@@ -165,7 +167,7 @@ namespace steppable
 
         /**
          * @brief Multiplies two fractions together and stores the result in the current one.
-         * This function does it by doing a simple fraction multiplication and returns the sum.
+         * The cross GCDs of each top component and the other bottom component are divided out before multiplying.
          *
          * @param[in] rhs The other fraction.
          * @return The current fraction.
@@ -174,11 +176,11 @@ namespace steppable
 
         /**
          * @brief Divides a fraction by abother fraction and stores the result in the current one.
-         * This function does it by doing a simple fraction division (multiply by inverse) and
-         * returns the sum.
+         * This function does it by multiplying by the reciprocal of the other fraction.
          *
          * @param[in] rhs The other fraction.
-         * @return The sum of fractions.
+         * @return The current fraction.
+         * @throws ZeroDenominatorException when the other fraction is zero.
          */
         Fraction& operator/=(const Fraction& rhs);
 
@@ -29,12 +29,18 @@
 
 #pragma once
 
+#include "steppable/fraction.hpp"
 #include "steppable/number.hpp"
 #include "testing.hpp"
 #include "types/point.hpp"
 
 #include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <span>
+#include <string>
 #include <string_view>
+#include <type_traits>
 #include <vector>
 
 namespace steppable
@@ -46,6 +52,234 @@ namespace steppable
     template<typename NumberT>
     using MatVec2D = std::vector<std::vector<NumberT>>;
 
+    /**
+     * @enum EliminationMode
+     * @brief Specifies how the elements of a matrix are kept while it is eliminated.
+     */
+    enum class EliminationMode : std::uint8_t
+    {
+        /// @brief Keep the elements exact if they are all integers, and round them otherwise.
+        AUTOMATIC = 0x00,
+
+        /// @brief Round the elements to the precision of the matrix after each step.
+        ROUNDED = 0x01,
+
+        /// @brief Keep the elements exact, as fractions.
+        EXACT = 0x02,
+    };
+
+    /**
+     * @class MatrixLine
+     * @brief A non-owning view of a row or a column of a matrix.
+     * @details Adjacent elements of the line are `stride` elements apart in the storage of the matrix. Rows have a
+     * stride of 1, and columns have a stride of the number of columns.
+     *
+     * @tparam NumberT The type of the elements. Use a const type for a read-only view.
+     */
+    template<typename NumberT>
+    class MatrixLine
+    {
+        NumberT* first = nullptr; ///< The first element of the line.
+        size_t count = 0; ///< The number of elements in the line.
+        size_t stride = 1; ///< The distance between adjacent elements in the storage.
+
+    public:
+        /**
+         * @class Iterator
+         * @brief Iterates through the elements of a line.
+         */
+        class Iterator
+        {
+            NumberT* first = nullptr; ///< The first element of the line.
+            size_t index = 0; ///< The index of the current element.
+            size_t stride = 1; ///< The distance between adjacent elements in the storage.
+
+        public:
+            using iterator_concept = std::forward_iterator_tag;
+            using value_type = std::remove_const_t<NumberT>;
+            using difference_type = std::ptrdiff_t;
+
+            Iterator() = default;
+
+            Iterator(NumberT* first, const size_t index, const size_t stride) :
+                first(first), index(index), stride(stride)
+            {
+            }
+
+            NumberT& operator*() const { return first[index * stride]; }
+
+            Iterator& operator++()
+            {
+                index++;
+                return *this;
+            }
+
+            Iterator operator++(int)
+            {
+                auto old = *this;
+                index++;
+                return old;
+            }
+
+            bool operator==(const Iterator& rhs) const { return index == rhs.index; }
+        };
+
+        MatrixLine() = default;
+
+        /**
+         * @brief Creates a view of a line.
+         *
+         * @param first The first element of the line.
+         * @param count The number of elements in the line.
+         * @param stride The distance between adjacent elements in the storage.
+         */
+        MatrixLine(NumberT* first, const size_t count, const size_t stride) :
+            first(first), count(count), stride(stride)
+        {
+        }
+
+        /**
+         * @brief Converts a writable view to a read-only one.
+         * @param line The writable view.
+         */
+        template<typename OtherT>
+            requires std::is_same_v<const OtherT, NumberT>
+        MatrixLine(const MatrixLine<OtherT>& line) : first(line.data()), count(line.size()), stride(line.getStride())
+        {
+        }
+
+        /**
+         * @brief Gets an element of the line.
+         * @param index The index of the element.
+         * @return A reference to the element.
+         */
+        NumberT& operator[](const size_t index) const { return first[index * stride]; }
+
+        /**
+         * @brief Gets the number of elements in the line.
+         * @return The number of elements.
+         */
+        [[nodiscard]] size_t size() const { return count; }
+
+        /**
+         * @brief Gets the distance between adjacent elements in the storage.
+         * @return The stride of the line.
+         */
+        [[nodiscard]] size_t getStride() const { return stride; }
+
+        /**
+         * @brief Gets the first element of the line.
+         * @return A pointer to the first element.
+         */
+        [[nodiscard]] NumberT* data() const { return first; }
+
+        [[nodiscard]] Iterator begin() const { return { first, 0, stride }; }
+
+        [[nodiscard]] Iterator end() const { return { first, count, stride }; }
+    };
+
+    /**
+     * @class MatrixView
+     * @brief A non-owning view of the elements of a matrix, which are stored row by row in a single buffer.
+     * @details The view is only valid while the matrix that it refers to is alive and is not resized. Iterating over
+     * the view yields the rows of the matrix.
+     *
+     * @tparam NumberT The type of the elements. Use a const type for a read-only view.
+     */
+    template<typename NumberT>
+    class MatrixView
+    {
+        NumberT* first = nullptr; ///< The first element of the matrix.
+        size_t rows = 0; ///< The number of rows.
+        size_t cols = 0; ///< The number of columns, which is also the distance between the starts of two rows.
+
+    public:
+        /**
+         * @class Iterator
+         * @brief Iterates through the rows of a matrix.
+         */
+        class Iterator
+        {
+            NumberT* first = nullptr; ///< The first element of the matrix.
+            size_t cols = 0; ///< The number of columns.
+            size_t index = 0; ///< The index of the current row.
+
+        public:
+            using iterator_concept = std::forward_iterator_tag;
+            using value_type = MatrixLine<NumberT>;
+            using difference_type = std::ptrdiff_t;
+
+            Iterator() = default;
+
+            Iterator(NumberT* first, const size_t cols, const size_t index) : first(first), cols(cols), index(index) {}
+
+            MatrixLine<NumberT> operator*() const { return { first + (index * cols), cols, 1 }; }
+
+            Iterator& operator++()
+            {
+                index++;
+                return *this;
+            }
+
+            Iterator operator++(int)
+            {
+                auto old = *this;
+                index++;
+                return old;
+            }
+
+            bool operator==(const Iterator& rhs) const { return index == rhs.index; }
+        };
+
+        MatrixView() = default;
+
+        /**
+         * @brief Creates a view of a matrix.
+         *
+         * @param first The first element of the matrix.
+         * @param rows The number of rows.
+         * @param cols The number of columns.
+         */
+        MatrixView(NumberT* first, const size_t rows, const size_t cols) : first(first), rows(rows), cols(cols) {}
+
+        /**
+         * @brief Gets a row of the matrix. The elements of a row are contiguous.
+         * @param y The index of the row.
+         * @return A view of the row.
+         */
+        [[nodiscard]] MatrixLine<NumberT> row(const size_t y) const { return { first + (y * cols), cols, 1 }; }
+
+        /**
+         * @brief Gets a column of the matrix. The elements of a column are one row apart.
+         * @param x The index of the column.
+         * @return A view of the column.
+         */
+        [[nodiscard]] MatrixLine<NumberT> col(const size_t x) const { return { first + x, rows, cols }; }
+
+        /**
+         * @brief Gets an element of the matrix. The index is not checked.
+         * @param point The position of the element.
+         * @return A reference to the element.
+         */
+        NumberT& operator[](const YXPoint& point) const { return first[(point.y * cols) + point.x]; }
+
+        /**
+         * @brief Get the number of rows in the matrix.
+         * @return The number of rows in the matrix.
+         */
+        [[nodiscard]] size_t getRows() const { return rows; }
+
+        /**
+         * @brief Get the number of columns in the matrix.
+         * @return The number of columns in the matrix.
+         */
+        [[nodiscard]] size_t getCols() const { return cols; }
+
+        [[nodiscard]] Iterator begin() const { return { first, cols, 0 }; }
+
+        [[nodiscard]] Iterator end() const { return { first, cols, rows }; }
+    };
+
     namespace prettyPrint::printers
     {
         /**
@@ -53,7 +287,7 @@ namespace steppable
          * @param matrix The matrix to be pretty printed.
          * @return A string representation of the matrix.
          */
-        std::string ppMatrix(const MatVec2D<Number>& matrix, int endRows = 0);
+        std::string ppMatrix(const MatrixView<const Number>& matrix, int endRows = 0);
     } // namespace prettyPrint::printers
 
     namespace __internals::symbols
@@ -66,16 +300,20 @@ namespace steppable
         constexpr std::string_view MATRIX_RIGHT_BOTTOM = "\u23A6";
     } // namespace __internals::symbols
 
+    class LUDecomposition;
+
     /**
      * @class Matrix
      * @brief Represents a mathematical matrix.
      */
     class Matrix
     {
+        friend class LUDecomposition;
+
         size_t _cols; ///< The number of columns in the matrix.
         size_t _rows; ///< The number of rows in the matrix.
         size_t prec = 10; ///< Precision of numbers in the matrix.
-        MatVec2D<Number> data; ///< The data of the matrix.
+        std::vector<Number> data; ///< The elements of the matrix, stored row by row in a single buffer.
 
         /**
          * @brief Checks whether a point is inside the matrix. Errors and exits the program if not.
@@ -84,19 +322,46 @@ namespace steppable
         void _checkIdxSanity(const YXPoint* point) const;
 
         /**
-         * @brief Checks whether the matrix data is correct in format.
-         * @details This method checks for non-uniform rows inside the matrix.
+         * @brief Checks whether a row of the matrix data has the same length as the others. Errors and exits the
+         * program if not.
          *
-         * @param data The matrix data vector.
+         * @param rowSize The length of the row.
+         * @param cols The number of columns in the matrix.
          */
-        static void _checkDataSanity(const MatVec2D<Number>& data);
+        static void _checkRowSanity(size_t rowSize, size_t cols);
 
         /**
-         * @brief Rounds off all data inside a vector to a specified precision.
-         * @param data A double `std::vector` object containing matrix data.
+         * @brief Checks whether another matrix has the same dimensions. Errors and exits the program if not.
+         *
+         * @param rhs The other matrix.
+         * @param name The name of the operation, used in the error message.
+         */
+        void _checkSameSize(const Matrix& rhs, const std::string& name) const;
+
+        /**
+         * @brief Checks whether another matrix has the same number of rows. Errors and exits the program if not.
+         *
+         * @param rhs The other matrix.
+         * @param name The name of the operation, used in the error message.
+         */
+        void _checkSameRows(const Matrix& rhs, const std::string& name) const;
+
+        /**
+         * @brief Rounds off values of the matrix to a specified precision, in place.
+         * @param data The matrix elements to round off.
          * @param prec Precision of the matrix.
          */
-        static MatVec2D<Number> roundOffValues(const MatVec2D<Number>& data, size_t prec);
+        static void roundOffValues(std::span<Number> data, size_t prec);
+
+        /**
+         * @brief Constructs a matrix from a buffer of elements, stored row by row.
+         *
+         * @param rows The number of rows.
+         * @param cols The number of columns.
+         * @param data The elements of the matrix.
+         * @param prec Precision of the numbers.
+         */
+        Matrix(size_t rows, size_t cols, std::vector<Number> data, size_t prec);
 
     public:
         /**
@@ -136,17 +401,32 @@ namespace steppable
         Matrix(const MatVec2D<ValueT>& data, const size_t prec) :
             _cols(data.front().size()), _rows(data.size()), prec(prec)
         {
-            this->data = std::vector(_rows, std::vector(_cols, Number("0")));
-            for (size_t i = 0; i < _rows; i++)
-                for (size_t j = 0; j < _cols; j++)
-                    this->data[i][j] = Number(data[i][j], prec);
+            for (const auto& row : data)
+                _checkRowSanity(row.size(), _cols);
+            this->data.reserve(_rows * _cols);
+            for (const auto& row : data)
+                for (const auto& value : row)
+                    this->data.emplace_back(value, prec);
         }
 
         /**
          * @brief Converts the matrix to its reduced row echelon form.
+         * @details In exact mode, the matrix is eliminated without fractions (Bareiss), with every division exact, and
+         * each element of the result is rounded once. Elements that are not numbers are always rounded.
+         *
+         * @param mode How the elements are kept during elimination.
          * @return A new Matrix in reduced row echelon form.
          */
-        [[nodiscard]] Matrix rref() const;
+        [[nodiscard]] Matrix rref(EliminationMode mode = EliminationMode::AUTOMATIC) const;
+
+        /**
+         * @brief Converts the matrix to its reduced row echelon form, with exact fractions as elements.
+         * @details The matrix is eliminated without fractions (Bareiss), and each row is divided by its pivot at the
+         * end. Errors and exits the program if an element is not a number.
+         *
+         * @return The elements of the reduced row echelon form, in lowest terms.
+         */
+        [[nodiscard]] MatVec2D<Fraction> rrefFractions() const;
 
         /**
          * @brief Converts a matrix to row echelon form.
@@ -157,10 +437,15 @@ namespace steppable
 
         /**
          * @brief Find the determinant of a matrix.
-         * @details Calculates the reduced echelon form of the matrix.
+         * @details In exact mode, each row is scaled to integers and the matrix is eliminated without fractions
+         * (Bareiss), so the determinant is exact. Otherwise, the LU decomposition of the matrix is calculated. To find
+         * the determinant together with the inverse or solutions of the matrix, use LUDecomposition directly, so that
+         * the matrix is only factored once.
+         *
+         * @param mode How the elements are kept during elimination.
          * @return A Number object representing the determinant.
          */
-        [[nodiscard]] Number det() const;
+        [[nodiscard]] Number det(EliminationMode mode = EliminationMode::AUTOMATIC) const;
 
         /**
          * @brief Presents the matrix as a string.
@@ -208,23 +493,69 @@ namespace steppable
         }
 
         /**
-         * @brief Alias for the data `begin()` method to allow iterating over the matrix rows,
+         * @brief Allows iterating over the matrix rows.
+         * @return The beginning of the matrix rows.
+         */
+        [[nodiscard]] auto begin() { return MatrixView<Number>(data.data(), _rows, _cols).begin(); }
+
+        /**
+         * @brief Allows iterating over the matrix rows.
+         * @return The end of the matrix rows.
+         */
+        [[nodiscard]] auto end() { return MatrixView<Number>(data.data(), _rows, _cols).end(); }
+
+        /**
+         * @brief Allows iterating over the matrix rows.
          * @return The beginning of the matrix rows.
          */
-        auto begin() { return data.begin(); }
+        [[nodiscard]] auto begin() const { return getData().begin(); }
 
         /**
-         * @brief Alias for the data `end()` method to allow iterating over the matrix rows,
+         * @brief Allows iterating over the matrix rows.
          * @return The end of the matrix rows.
          */
-        auto end() { return data.end(); }
+        [[nodiscard]] auto end() const { return getData().end(); }
+
+        /**
+         * @brief Gets a row of the matrix. The index is not checked.
+         * @param y The index of the row.
+         * @return A view of the row, whose elements are contiguous.
+         */
+        [[nodiscard]] MatrixLine<Number> row(const size_t y) { return { data.data() + (y * _cols), _cols, 1 }; }
+
+        /**
+         * @brief Gets a row of the matrix. The index is not checked.
+         * @param y The index of the row.
+         * @return A read-only view of the row, whose elements are contiguous.
+         */
+        [[nodiscard]] MatrixLine<const Number> row(const size_t y) const
+        {
+            return { data.data() + (y * _cols), _cols, 1 };
+        }
+
+        /**
+         * @brief Gets a column of the matrix. The index is not checked.
+         * @param x The index of the column.
+         * @return A view of the column, whose elements are one row apart.
+         */
+        [[nodiscard]] MatrixLine<Number> col(const size_t x) { return { data.data() + x, _rows, _cols }; }
+
+        /**
+         * @brief Gets a column of the matrix. The index is not checked.
+         * @param x The index of the column.
+         * @return A read-only view of the column, whose elements are one row apart.
+         */
+        [[nodiscard]] MatrixLine<const Number> col(const size_t x) const { return { data.data() + x, _rows, _cols }; }
 
         /**
          * @brief Calculates the rank of a matrix.
-         * @details Calculates the number of non-zero rows when the matrix is converted to row-echelon form.
+         * @details Calculates the number of non-zero rows when the matrix is converted to row-echelon form. In exact
+         * mode, the pivots are found without fractions (Bareiss), so that no pivot is lost to rounding.
+         *
+         * @param mode How the elements are kept during elimination.
          * @return The rank of the matrix.
          */
-        [[nodiscard]] Number rank() const;
+        [[nodiscard]] Number rank(EliminationMode mode = EliminationMode::AUTOMATIC) const;
 
         /**
          * @brief Transposes a matrix.
@@ -240,7 +571,34 @@ namespace steppable
          * @param rhs The other matrix.
          * @return A new matrix with the addition result.
          */
-        Matrix operator+(const Matrix& rhs) const;
+        Matrix operator+(const Matrix& rhs) const&;
+
+        /**
+         * @brief Add a matrix to a temporary matrix.
+         * @details The sum is calculated in place, in the storage of the temporary matrix.
+         *
+         * @param rhs The other matrix.
+         * @return The temporary matrix, holding the addition result.
+         */
+        Matrix operator+(const Matrix& rhs) &&;
+
+        /**
+         * @brief Add a temporary matrix to a matrix.
+         * @details The sum is calculated in place, in the storage of the temporary matrix.
+         *
+         * @param rhs The other matrix, which is temporary.
+         * @return The temporary matrix, holding the addition result.
+         */
+        Matrix operator+(Matrix&& rhs) const&;
+
+        /**
+         * @brief Add a temporary matrix to another temporary matrix.
+         * @details The sum is calculated in place, in the storage of the current matrix.
+         *
+         * @param rhs The other matrix, which is temporary.
+         * @return The current matrix, holding the addition result.
+         */
+        Matrix operator+(Matrix&& rhs) &&;
 
         /**
          * @brief Adds the other matrix to current matrix and assigns result to this matrix.
@@ -249,9 +607,9 @@ namespace steppable
          * addition.
          *
          * @param rhs The other matrix.
-         * @return Instance of a new matrix after addition.
+         * @return A reference to the current matrix after addition.
          */
-        Matrix operator+=(const Matrix& rhs);
+        Matrix& operator+=(const Matrix& rhs);
 
         /**
          * @brief Unary plus operator.
@@ -267,7 +625,34 @@ namespace steppable
          * @param rhs The other matrix.
          * @return A new matrix with the subtraction result.
          */
-        Matrix operator-(const Matrix& rhs) const;
+        Matrix operator-(const Matrix& rhs) const&;
+
+        /**
+         * @brief Subtract a matrix from a temporary matrix.
+         * @details The difference is calculated in place, in the storage of the temporary matrix.
+         *
+         * @param rhs The other matrix.
+         * @return The temporary matrix, holding the subtraction result.
+         */
+        Matrix operator-(const Matrix& rhs) &&;
+
+        /**
+         * @brief Subtract a temporary matrix from a matrix.
+         * @details The difference is calculated in place, in the storage of the temporary matrix.
+         *
+         * @param rhs The other matrix, which is temporary.
+         * @return The temporary matrix, holding the subtraction result.
+         */
+        Matrix operator-(Matrix&& rhs) const&;
+
+        /**
+         * @brief Subtract a temporary matrix from another temporary matrix.
+         * @details The difference is calculated in place, in the storage of the current matrix.
+         *
+         * @param rhs The other matrix, which is temporary.
+         * @return The current matrix, holding the subtraction result.
+         */
+        Matrix operator-(Matrix&& rhs) &&;
 
         /**
          * @brief Subtracts the other matrix from current matrix and assigns result to this matrix.
@@ -276,9 +661,9 @@ namespace steppable
          * subtraction.
          *
          * @param rhs The other matrix.
-         * @return Instance of a new matrix after subtraction.
+         * @return A reference to the current matrix after subtraction.
          */
-        Matrix operator-=(const Matrix& rhs);
+        Matrix& operator-=(const Matrix& rhs);
 
         /**
          * @brief Unary minus operator.
@@ -286,7 +671,14 @@ namespace steppable
          * instance of the matrix.
          * @return A matrix with equal values in the opposite sign.
          */
-        Matrix operator-() const;
+        Matrix operator-() const&;
+
+        /**
+         * @brief Unary minus operator for a temporary matrix.
+         * @details Negates the values in place, in the storage of the temporary matrix.
+         * @return The temporary matrix, with all values in the opposite sign.
+         */
+        Matrix operator-() &&;
 
         /**
          * @brief Scalar multiplication.
@@ -295,7 +687,16 @@ namespace steppable
          * @param rhs The scalar to multiply.
          * @return A new matrix after the scalar multiplication
          */
-        Matrix operator*(const Number& rhs) const;
+        Matrix operator*(const Number& rhs) const&;
+
+        /**
+         * @brief Scalar multiplication of a temporary matrix.
+         * @details Multiplies each element in place, in the storage of the temporary matrix.
+         *
+         * @param rhs The scalar to multiply.
+         * @return The temporary matrix after the scalar multiplication.
+         */
+        Matrix operator*(const Number& rhs) &&;
 
         /**
          * @brief Multiplies the current matrix by a scalar value and assigns the result to this matrix.
@@ -304,13 +705,15 @@ namespace steppable
          * by multiplying it with the provided scalar value.
          *
          * @param rhs The scalar value to multiply each element of the matrix by.
-         * @return Instance of a modified matrix after multiplication.
+         * @return A reference to the current matrix after multiplication.
          */
-        Matrix operator*=(const Number& rhs);
+        Matrix& operator*=(const Number& rhs);
 
         /**
          * @brief Matrix multiplication.
-         * @details Multiplies a matrix by another matrix, returning the resulting matrix.
+         * @details Multiplies a matrix by another matrix, returning the resulting matrix. Each entry of the result is
+         * accumulated exactly and rounded once. Tiles of the result are calculated on the shared thread pool, and large
+         * products with long entries are split with the Strassen-Winograd scheme.
          *
          * @param rhs The other matrix to multiply.
          * @return The new matrix after multiplying.
@@ -324,14 +727,16 @@ namespace steppable
          * The current matrix is updated to be the product of itself and rhs.
          *
          * @param rhs The matrix to multiply with this matrix.
-         * @return The updated matrix after multiplication.
+         * @return A reference to the current matrix after multiplication.
          */
-        Matrix operator*=(const Matrix& rhs);
+        Matrix& operator*=(const Matrix& rhs);
 
         /**
          * @brief Raises the current matrix to a certain power.
-         * @details Only positive integers (including zero) and the negative number -1 are allowed. Only square matrices
-         * are supported. The matrix is multiplied by itself for a specified number of times.
+         * @details Any integer is allowed as the power, and only square matrices are supported. The power is calculated
+         * by repeated squaring, with at most 2 log2(n) matrix products, each rounded as a matrix product is. A negative
+         * power is a positive power of the inverse, so the matrix is only inverted once. The power zero gives the
+         * identity matrix.
          *
          * @param times Times to raise the matrix to.
          * @return A new matrix of the power result.
@@ -340,13 +745,12 @@ namespace steppable
 
         /**
          * @brief Raises the current matrix to a certain power, and assigns result to the current matrix.
-         * @details Only positive integers (including zero) and the negative number -1 are allowed. Only square matrices
-         * are supported.
+         * @details Any integer is allowed as the power, and only square matrices are supported.
          *
          * @param times Times to raise the matrix to.
-         * @return The current matrix.
+         * @return A reference to the current matrix.
          */
-        Matrix operator^=(const Number& times);
+        Matrix& operator^=(const Number& times);
 
         /**
          * @brief Join a matrix to the right of the current matrix.
@@ -361,12 +765,12 @@ namespace steppable
         /**
          * @brief Join a matrix to the right of the current matrix, then assign the result to the current one.
          * @details Joins a matrix to the right of the current matrix. Requires two matrices to have to same number of
-         * rows. The result is assigned to the current matrix.
+         * rows. The rows of the current matrix are widened in place, and it takes the higher precision of the two.
          *
          * @param rhs The other matrix to join.
-         * @return A new matrix where the two matrices are joined.
+         * @return A reference to the current matrix, where the two matrices are joined.
          */
-        Matrix operator<<=(const Matrix& rhs);
+        Matrix& operator<<=(const Matrix& rhs);
 
         /**
          * @brief Join a matrix to the left of the current matrix.
@@ -381,12 +785,12 @@ namespace steppable
         /**
          * @brief Join a matrix to the left of the current matrix, then assign the result to the current one.
          * @details Joins a matrix to the left of the current matrix. Requires two matrices to have to same number of
-         * rows. The result is assigned to the current matrix.
+         * rows. The rows of the current matrix are widened in place, and it takes the higher precision of the two.
          *
          * @param rhs The other matrix to join.
-         * @return A new matrix where the two matrices are joined.
+         * @return A reference to the current matrix, where the two matrices are joined.
          */
-        Matrix operator>>=(const Matrix& rhs);
+        Matrix& operator>>=(const Matrix& rhs);
 
         /**
          * @brief Test for equal matrices.
@@ -452,9 +856,99 @@ namespace steppable
         [[nodiscard]] size_t getCols() const { return _cols; }
 
         /**
-         * @brief Get the data std::vector object from the matrix.
-         * @return A std::vector object containing all the matrix data.
+         * @brief Get a view of the matrix data, without copying it.
+         * @return A read-only view of the matrix elements, which is valid while the matrix is alive and unchanged in
+         * size.
+         */
+        [[nodiscard]] MatrixView<const Number> getData() const { return { data.data(), _rows, _cols }; }
+    };
+
+    /**
+     * @class LUDecomposition
+     * @brief The LU decomposition of a square matrix, PA = LU, with partial pivoting.
+     * @details The matrix is factored once, so that its determinant, its inverse and the solutions of any number of
+     * systems with it are calculated without eliminating it again. L has ones on its diagonal and is packed together
+     * with U in a single buffer.
+     */
+    class LUDecomposition
+    {
+        size_t size; ///< The number of rows and columns of the matrix.
+        size_t prec; ///< Precision of the matrix that was factored.
+        long long decimals; ///< The number of decimal places that the factors are kept to.
+        std::vector<__internals::bignum::BigDecimal> factors; ///< L below the diagonal and U above it, row by row.
+        std::vector<size_t> permutation; ///< The row of the matrix that is at each row of the factors.
+        bool oddPermutation = false; ///< Whether an odd number of rows were swapped.
+        bool singular = false; ///< Whether the matrix is singular.
+
+        /**
+         * @brief Checks whether the matrix is invertible. Errors and exits the program if not.
+         * @param name The name of the operation, used in the error message.
+         */
+        void _checkInvertible(const std::string& name) const;
+
+        /**
+         * @brief Solves LUx = Pb for one right-hand side, in place.
+         * @param x The right-hand side, which becomes the solution. It is not permuted yet.
+         */
+        void solveInPlace(std::vector<__internals::bignum::BigDecimal>& x) const;
+
+    public:
+        /**
+         * @brief Factors a square matrix.
+         * @details In each column, the element with the largest magnitude at or below the diagonal is taken as the
+         * pivot. A matrix of integers is singular if its exact rank is not full. Otherwise, it is singular if a pivot
+         * is below 10^-prec times the largest element of its column. Errors and exits the program if the matrix is not
+         * square, or if an element is not a number.
+         *
+         * @param matrix The matrix to factor.
+         */
+        explicit LUDecomposition(const Matrix& matrix);
+
+        /**
+         * @brief Checks whether the matrix is singular, i.e., whether it has no inverse.
+         * @return True if the matrix is singular.
+         */
+        [[nodiscard]] bool isSingular() const { return singular; }
+
+        /**
+         * @brief Gets the permutation of the rows.
+         * @return The row of the matrix that is at each row of the factors.
+         */
+        [[nodiscard]] const std::vector<size_t>& getPermutation() const { return permutation; }
+
+        /**
+         * @brief Gets the lower triangular factor, which has ones on its diagonal.
+         * @return L.
+         */
+        [[nodiscard]] Matrix lower() const;
+
+        /**
+         * @brief Gets the upper triangular factor.
+         * @return U.
+         */
+        [[nodiscard]] Matrix upper() const;
+
+        /**
+         * @brief Finds the determinant of the matrix, i.e., the product of the pivots.
+         * @return The determinant.
+         */
+        [[nodiscard]] Number det() const;
+
+        /**
+         * @brief Solves the system Ax = b.
+         * @details Each column of `b` is a separate right-hand side, and the columns are solved on the shared thread
+         * pool. Errors and exits the program if the matrix is singular.
+         *
+         * @param b The right-hand sides, with as many rows as the matrix.
+         * @return The solutions, one column for each right-hand side.
+         */
+        [[nodiscard]] Matrix solve(const Matrix& b) const;
+
+        /**
+         * @brief Finds the inverse of the matrix, by solving for each column of the identity matrix.
+         * @details Errors and exits the program if the matrix is singular.
+         * @return The inverse.
          */
-        [[nodiscard]] MatVec2D<Number> getData() const { return data; }
+        [[nodiscard]] Matrix inverse() const;
     };
 } // namespace steppable
@@ -30,13 +30,16 @@
 
 #pragma once
 
+#include "bignum.hpp"
 #include "rounding.hpp"
 #include "testing.hpp"
 #include "types/rounding.hpp"
 #include "util.hpp"
 
+#include <compare>
 #include <functional>
 #include <string>
+#include <type_traits>
 #include <utility>
 
 /**
@@ -47,12 +50,25 @@ namespace steppable
 {
     /**
      * @class Number
-     * @brief Represents a number with arbitrary precision. It basically stores the value as a string.
+     * @brief Represents a number with arbitrary precision. It stores the value as a sign, a decimal exponent and a
+     * mantissa, and only converts it to a string when presenting.
+     *
+     * @details Mantissas that fit in 64 bits are stored inline and calculated on with native integers. Whenever a
+     * result does not fit, the number moves to base-10^9 limbs.
      */
     class Number
     {
-        /// @brief The value of the number.
-        std::string value;
+        /// @brief The value of the number, while its mantissa fits in 64 bits.
+        __internals::bignum::SmallDecimal small;
+
+        /// @brief The value of the number, once its mantissa no longer fits in 64 bits.
+        __internals::bignum::BigDecimal value;
+
+        /// @brief Whether the value is stored in `small` instead of `value`.
+        bool isSmall = true;
+
+        /// @brief Non-numeric results, such as "Infinity" or "Indeterminate". Empty for ordinary numbers.
+        std::string special;
 
         /// @brief The precision of the number.
         size_t prec;
@@ -83,6 +99,75 @@ namespace steppable
             return usePrec;
         }
 
+        /**
+         * @brief Initializes a number directly from its limb representation.
+         *
+         * @param value The value of the number.
+         * @param prec The precision of the number.
+         * @param mode The rounding mode of the number.
+         */
+        Number(__internals::bignum::BigDecimal value, size_t prec, RoundingMode mode);
+
+        /**
+         * @brief Initializes a number directly from its inline representation.
+         *
+         * @param value The value of the number.
+         * @param prec The precision of the number.
+         * @param mode The rounding mode of the number.
+         */
+        Number(const __internals::bignum::SmallDecimal& value, size_t prec, RoundingMode mode);
+
+        /**
+         * @brief Stores a value, inline if it fits in 64 bits.
+         * @param newValue The value to store.
+         */
+        void assign(__internals::bignum::BigDecimal newValue);
+
+        /**
+         * @brief Gets the value of the number as limbs.
+         * @return The value, converted from the inline representation if needed.
+         */
+        [[nodiscard]] __internals::bignum::BigDecimal big() const
+        {
+            return isSmall ? __internals::bignum::widen(small) : value;
+        }
+
+        /**
+         * @brief Checks whether the number is zero.
+         * @return True if the number is zero, false otherwise.
+         */
+        [[nodiscard]] bool isZero() const { return isSmall ? small.isZero() : value.isZero(); }
+
+        /**
+         * @brief Compares the values of two numbers, using native integers if both are stored inline.
+         *
+         * @param rhs The other number.
+         * @return The ordering of the current number relative to the other number.
+         */
+        [[nodiscard]] std::strong_ordering compareValue(const Number& rhs) const;
+
+        /**
+         * @brief Checks whether either operand holds a non-numeric result.
+         *
+         * @param rhs The other operand.
+         * @return True if one of the operands is non-numeric.
+         */
+        [[nodiscard]] bool eitherIsSpecial(const Number& rhs) const
+        {
+            return not special.empty() or not rhs.special.empty();
+        }
+
+        /**
+         * @brief Gets the non-numeric result out of two operands.
+         *
+         * @param rhs The other operand.
+         * @return A number holding the non-numeric value of either operand.
+         */
+        [[nodiscard]] Number propagateSpecial(const Number& rhs) const
+        {
+            return Number(special.empty() ? rhs.special : special, prec, mode);
+        }
+
     public:
         /**
          * @brief Initializes a number with a specified value.
@@ -91,23 +176,42 @@ namespace steppable
         Number(std::string value = "0", size_t prec = 10, RoundingMode mode = RoundingMode::USE_CURRENT_PREC);
 
         /**
-         * @brief Initializes a number with a C/C++ long double value.
-         * @note No matter how the number is specified, it will always be converted to a string for storage.
+         * @brief Initializes a number with a C/C++ numeric value.
+         * @note Integers are stored inline directly. Floating-point values are converted with std::to_string, so
+         * they are stored with six decimal places.
          */
         template<concepts::Numeric ValueT>
         Number(ValueT value, size_t prec = 10, RoundingMode mode = RoundingMode::USE_CURRENT_PREC) :
-            value(std::to_string(value)), prec(prec), mode(mode)
+            prec(prec), mode(mode)
         {
+            if constexpr (std::is_integral_v<ValueT>)
+            {
+                if constexpr (std::is_signed_v<ValueT>)
+                {
+                    small.negative = value < 0;
+                    small.mantissa = small.negative ? 0ULL - static_cast<unsigned long long>(value) :
+                                                      static_cast<unsigned long long>(value);
+                }
+                else
+                    small.mantissa = value;
+            }
+            else
+                set(std::to_string(value));
         }
 
-        void set(std::string newVal) { value = std::move(newVal); }
+        /**
+         * @brief Sets the value of the number from a string.
+         * @param newVal The new value. Non-numeric strings are kept as-is.
+         */
+        void set(std::string newVal);
 
-        void setPrec(size_t newPrec, RoundingMode mode = RoundingMode::USE_CURRENT_PREC)
-        {
-            this->mode = mode;
-            prec = newPrec;
-            value = __internals::numUtils::roundOff(value, prec);
-        }
+        /**
+         * @brief Sets the precision of the number and rounds the value off to it.
+         *
+         * @param newPrec The new precision.
+         * @param mode The new rounding mode.
+         */
+        void setPrec(size_t newPrec, RoundingMode mode = RoundingMode::USE_CURRENT_PREC);
 
         /**
          * @brief Adds two numbers together.
@@ -217,32 +321,12 @@ namespace steppable
         bool operator!=(const Number& rhs) const;
 
         /**
-         * @brief Compares two numbers for less than.
-         * @param rhs The number to compare.
-         * @return True if the current number is less than the other number, false otherwise.
-         */
-        bool operator<(const Number& rhs) const;
-
-        /**
-         * @brief Compares two numbers for greater than.
-         * @param rhs The number to compare.
-         * @return True if the current number is greater than the other number, false otherwise.
-         */
-        bool operator>(const Number& rhs) const;
-
-        /**
-         * @brief Compares two numbers for less than or equal to.
-         * @param rhs The number to compare.
-         * @return True if the current number is less than or equal to the other number, false otherwise.
-         */
-        bool operator<=(const Number& rhs) const;
-
-        /**
-         * @brief Compares two numbers for greater than or equal to.
+         * @brief Compares two numbers by their values.
          * @param rhs The number to compare.
-         * @return True if the current number is greater than or equal to the other number, false otherwise.
+         * @return The ordering of the current number relative to the other number. Non-numeric results, such as
+         * "Infinity", are unordered.
          */
-        bool operator>=(const Number& rhs) const;
+        std::partial_ordering operator<=>(const Number& rhs) const;
 
         /**
          * @brief Increments the number by one.
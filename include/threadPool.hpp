@@ -0,0 +1,125 @@
+/**************************************************************************************************
+ * Copyright (c) 2023-2025 NWSOFT                                                                 *
+ *                                                                                                *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy                   *
+ * of this software and associated documentation files (the "Software"), to deal                  *
+ * in the Software without restriction, including without limitation the rights                   *
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell                      *
+ * copies of the Software, and to permit persons to whom the Software is                          *
+ * furnished to do so, subject to the following conditions:                                       *
+ *                                                                                                *
+ * The above copyright notice and this permission notice shall be included in all                 *
+ * copies or substantial portions of the Software.                                                *
+ *                                                                                                *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR                     *
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,                       *
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE                    *
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER                         *
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,                  *
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE                  *
+ * SOFTWARE.                                                                                      *
+ **************************************************************************************************/
+
+
+/**
+ * @file threadPool.hpp
+ * @brief This file contains the declaration of the ThreadPool class, which runs independent tasks on worker threads.
+ *
+ * @author Andy Zhang
+ * @date 17th October 2026
+ */
+
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace steppable::__internals::utils
+{
+    /**
+     * @class ThreadPool
+     * @brief A fixed set of worker threads that share the tasks of a job.
+     * @details A job is a number of independent tasks. The tasks are handed out one at a time, so faster threads take
+     * more of them. The calling thread works on its own job too, and a job started from inside a task runs
+     * sequentially on the thread that started it, so that nested jobs cannot wait on each other.
+     */
+    class ThreadPool
+    {
+    private:
+        struct Job;
+
+        /// @brief The jobs that still have tasks to hand out.
+        std::deque<std::shared_ptr<Job>> jobs;
+
+        /// @brief Guards the jobs and the number of finished tasks of each job.
+        std::mutex mutex;
+
+        /// @brief Wakes the workers when a job is added or the pool is stopping.
+        std::condition_variable jobAdded;
+
+        /// @brief Wakes the callers when all tasks of a job have finished.
+        std::condition_variable jobFinished;
+
+        /// @brief Whether the pool is being destroyed.
+        bool stopping = false;
+
+        /// @brief The worker threads.
+        std::vector<std::jthread> workers;
+
+        /**
+         * @brief Runs tasks of a job until none are left to hand out.
+         *
+         * @param job The job.
+         */
+        void work(Job& job);
+
+        /// @brief The loop of a worker thread.
+        void workerLoop();
+
+    public:
+        /**
+         * @brief Starts a pool with a number of worker threads.
+         *
+         * @param workerCount The number of worker threads, not counting the threads that start jobs.
+         */
+        explicit ThreadPool(size_t workerCount);
+
+        ThreadPool(const ThreadPool&) = delete;
+        ThreadPool& operator=(const ThreadPool&) = delete;
+
+        /**
+         * @brief Stops the pool. Jobs that are running are finished first.
+         */
+        ~ThreadPool();
+
+        /**
+         * @brief Gets the pool shared by the whole program.
+         * @details It has one worker less than the number of hardware threads, as the calling thread works too.
+         *
+         * @return The shared pool.
+         */
+        static ThreadPool& instance();
+
+        /**
+         * @brief Gets the number of threads that work on a job, including the calling thread.
+         *
+         * @return The number of threads.
+         */
+        [[nodiscard]] size_t concurrency() const;
+
+        /**
+         * @brief Runs task(0), task(1), ..., task(count - 1) and waits for all of them to finish.
+         * @note If a task throws, the other tasks still run, and the first exception is thrown again afterwards.
+         *
+         * @param count The number of tasks.
+         * @param task The task. It may be called from several threads at once.
+         */
+        void run(size_t count, const std::function<void(size_t)>& task);
+    };
+} // namespace steppable::__internals::utils
@@ -30,6 +30,7 @@
 
 #include "argParse.hpp"
 #include "baseConvertReport.hpp"
+#include "bignum.hpp"
 #include "fn/calc.hpp"
 #include "getString.hpp"
 #include "output.hpp"
@@ -103,6 +104,36 @@ namespace steppable::__internals::calc
             return "Impossible";
         }
 
+        // Integers are converted by the limb backend, which splits the number recursively instead of dividing once for
+        // every digit.
+        bignum::BigDecimal parsed;
+        const bool isNumber = bignum::parse(_number, parsed);
+        bignum::stripTrailingZeros(parsed);
+        if (isNumber and parsed.exponent >= 0)
+        {
+            const auto magnitude = bignum::shiftLeftDigits(parsed.mantissa, parsed.exponent);
+            if (steps == 2)
+                for (auto current = magnitude; not current.empty();)
+                {
+                    const auto dividend = bignum::toString(bignum::BigDecimal{ .mantissa = current });
+                    const auto remainder = bignum::divideSmall(current, static_cast<bignum::Limb>(base));
+                    std::cout << reportBaseConvertStep(dividend,
+                                                       baseStr,
+                                                       bignum::toString(bignum::BigDecimal{ .mantissa = current }),
+                                                       bignum::toBase({ remainder }, static_cast<unsigned>(base)))
+                              << '\n';
+                }
+
+            const auto numerals = bignum::toBase(magnitude, static_cast<unsigned>(base));
+            std::vector<std::string> digits;
+            digits.reserve(numerals.size() + 1);
+            for (auto numeral = numerals.rbegin(); numeral != numerals.rend(); ++numeral)
+                digits.emplace_back(1, *numeral);
+            if (parsed.negative and not parsed.isZero())
+                digits.emplace_back("-");
+            return reportBaseConvert(numberOrig, baseStr, digits, steps);
+        }
+
         std::vector<std::string> digits;
         while (compare(number, "0", 0) != "2")
         {
@@ -26,6 +26,7 @@
  * decimal.
  */
 #include "argParse.hpp"
+#include "bignum.hpp"
 #include "decimalConvertReport.hpp"
 #include "fn/calc.hpp"
 #include "getString.hpp"
@@ -72,7 +73,15 @@ namespace steppable::__internals::calc
             return "Impossible";
         }
 
+        // Without steps to show, the limb backend joins the digits recursively instead of adding one place at a time.
+        bignum::Limbs magnitude;
+        if (const auto base = std::stoul(baseString);
+            steps != 2 and base >= 2 and bignum::fromBase(_inputString, base, magnitude))
+            return reportDecimalConvert(
+                _inputString, baseString, bignum::toString(bignum::BigDecimal{ .mantissa = magnitude }), steps);
+
         std::string converted = "0";
+        std::string placeValue = "1";
         std::string inputString = _inputString;
         std::ranges::reverse(inputString);
 
@@ -90,9 +99,9 @@ namespace steppable::__internals::calc
                       $("decimalConvert", "e97b6539-8f69-4ccb-a50e-82a66aff2898", { digit, baseString }));
                 return "Impossible";
             }
-            auto placeValue = power(baseString, std::to_string(index), 0);
             auto convertedDigit = multiply(placeValue, digit, 0);
             converted = add(converted, convertedDigit, 0);
+            placeValue = multiply(placeValue, baseString, 0);
 
             if (steps == 2)
                 ss << reportDecimalConvertStep(baseString, digit, index, convertedDigit, maxWidth) << '\n';
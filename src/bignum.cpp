@@ -0,0 +1,570 @@
+/**************************************************************************************************
+ * Copyright (c) 2023-2025 NWSOFT                                                                 *
+ *                                                                                                *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy                   *
+ * of this software and associated documentation files (the "Software"), to deal                  *
+ * in the Software without restriction, including without limitation the rights                   *
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell                      *
+ * copies of the Software, and to permit persons to whom the Software is                          *
+ * furnished to do so, subject to the following conditions:                                       *
+ *                                                                                                *
+ * The above copyright notice and this permission notice shall be included in all                 *
+ * copies or substantial portions of the Software.                                                *
+ *                                                                                                *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR                     *
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,                       *
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE                    *
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER                         *
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,                  *
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE                  *
+ * SOFTWARE.                                                                                      *
+ **************************************************************************************************/
+
+/**
+ * @file bignum.cpp
+ * @brief This file contains the implementation of the limb-based arbitrary precision backend.
+ *
+ * @author Andy Zhang
+ * @date 16th October 2026
+ */
+
+#include "bignum.hpp"
+
+#include <algorithm>
+#include <charconv>
+#include <cmath>
+#include <string>
+#include <utility>
+
+namespace steppable::__internals::bignum
+{
+    namespace
+    {
+        /**
+         * @brief Divides a magnitude by a power of ten, discarding the remainder.
+         *
+         * @param[in] a The magnitude to divide.
+         * @param[in] digits The number of digits to drop.
+         * @param[out] firstDropped The most significant of the dropped digits.
+         * @return The truncated magnitude.
+         */
+        Limbs shiftRightDigits(const Limbs& a, const long long digits, int& firstDropped)
+        {
+            firstDropped = 0;
+            const auto limbShift = static_cast<size_t>(digits / LIMB_DIGITS);
+            const auto digitShift = static_cast<int>(digits % LIMB_DIGITS);
+            if (limbShift >= a.size())
+            {
+                if (limbShift == a.size() and digitShift == 0 and not a.empty())
+                    firstDropped = static_cast<int>(a.back() / POW10[LIMB_DIGITS - 1]);
+                return {};
+            }
+
+            Limbs result(a.begin() + static_cast<long>(limbShift), a.end());
+            if (digitShift == 0)
+            {
+                if (limbShift > 0)
+                    firstDropped = static_cast<int>(a[limbShift - 1] / POW10[LIMB_DIGITS - 1]);
+            }
+            else
+            {
+                const Limb remainder = divideSmall(result, POW10[digitShift]);
+                firstDropped = static_cast<int>(remainder / POW10[digitShift - 1]);
+            }
+            return result;
+        }
+
+        /**
+         * @brief Gets nine consecutive digits of a magnitude as a limb.
+         *
+         * @param[in] a The magnitude.
+         * @param[in] offset The position of the lowest digit to get, may be negative.
+         * @return The digits at [offset, offset + 9), with digits outside the magnitude as zeros.
+         */
+        Limb limbAt(const Limbs& a, const long long offset)
+        {
+            if (offset <= -LIMB_DIGITS or offset >= static_cast<long long>(a.size()) * LIMB_DIGITS)
+                return 0;
+            if (offset < 0)
+                return (a[0] % POW10[LIMB_DIGITS + offset]) * POW10[-offset];
+
+            const auto index = static_cast<size_t>(offset / LIMB_DIGITS);
+            const auto digitShift = offset % LIMB_DIGITS;
+            Limb result = a[index] / POW10[digitShift];
+            if (digitShift != 0 and index + 1 < a.size())
+                result += (a[index + 1] % POW10[digitShift]) * POW10[LIMB_DIGITS - digitShift];
+            return result;
+        }
+
+        /**
+         * @brief Compares the magnitudes of two non-zero numbers, aligning their exponents nine digits at a time.
+         *
+         * @param[in] a The first number.
+         * @param[in] b The second number.
+         * @return The ordering of |a| relative to |b|.
+         */
+        std::strong_ordering magnitudeOrdering(const BigDecimal& a, const BigDecimal& b)
+        {
+            if (a.exponent == b.exponent)
+                return compareMagnitude(a.mantissa, b.mantissa);
+
+            const long long aTop = countDigits(a.mantissa) + a.exponent;
+            const long long bTop = countDigits(b.mantissa) + b.exponent;
+            if (aTop != bTop)
+                return aTop <=> bTop;
+
+            const long long lowest = std::min(a.exponent, b.exponent);
+            for (long long position = aTop - LIMB_DIGITS; position + LIMB_DIGITS > lowest; position -= LIMB_DIGITS)
+            {
+                const Limb aDigits = limbAt(a.mantissa, position - a.exponent);
+                const Limb bDigits = limbAt(b.mantissa, position - b.exponent);
+                if (aDigits != bDigits)
+                    return aDigits <=> bDigits;
+            }
+            return std::strong_ordering::equal;
+        }
+
+        /**
+         * @struct DecimalDigits
+         * @brief The sign and significant digits of a decimal string, referring into the string.
+         */
+        struct DecimalDigits
+        {
+            bool negative = false; ///< Whether the number is written with a negative sign.
+            std::string_view integer; ///< The integer digits, without leading zeros.
+            std::string_view fraction; ///< The fractional digits, without trailing zeros.
+
+            [[nodiscard]] bool isZero() const { return integer.empty() and fraction.empty(); }
+        };
+
+        /**
+         * @brief Splits a decimal string into its sign and significant digits, accepting the same strings as parse().
+         *
+         * @param[in] string The string to split.
+         * @param[out] out The sign and digits.
+         * @return True if the string is a number, false otherwise.
+         */
+        bool splitDigits(const std::string_view string, DecimalDigits& out)
+        {
+            size_t start = 0;
+            out.negative = false;
+            while (start < string.size() and (string[start] == '-' or string[start] == '+'))
+            {
+                if (string[start] == '-')
+                    out.negative = not out.negative;
+                start++;
+            }
+
+            size_t pointPos = string.size();
+            size_t digitCount = 0;
+            for (size_t i = start; i < string.size(); i++)
+            {
+                if (string[i] == '.' and pointPos == string.size())
+                    pointPos = i;
+                else if (string[i] >= '0' and string[i] <= '9')
+                    digitCount++;
+                else
+                    return false;
+            }
+            if (digitCount == 0)
+                return false;
+
+            out.integer = string.substr(start, pointPos - start);
+            out.integer.remove_prefix(std::min(out.integer.find_first_not_of('0'), out.integer.size()));
+            out.fraction = pointPos < string.size() ? string.substr(pointPos + 1) : std::string_view{};
+            out.fraction = out.fraction.substr(0, out.fraction.find_last_not_of('0') + 1);
+            return true;
+        }
+
+        /**
+         * @brief Writes the digits of a mantissa out as a decimal string.
+         *
+         * @param[in] digits The digits of the mantissa, "0" for zero.
+         * @param[in] exponent The power of ten the mantissa is multiplied by.
+         * @param[in] negative Whether to write a negative sign.
+         * @return The decimal string.
+         */
+        std::string placeDecimalPoint(const std::string_view digits, const long long exponent, const bool negative)
+        {
+            std::string result;
+            if (negative)
+                result += '-';
+            if (exponent >= 0)
+            {
+                result += digits;
+                if (digits != "0")
+                    result.append(static_cast<size_t>(exponent), '0');
+                return result;
+            }
+
+            const auto decimals = static_cast<size_t>(-exponent);
+            if (digits.length() <= decimals)
+            {
+                result += "0.";
+                result.append(decimals - digits.length(), '0');
+                result += digits;
+            }
+            else
+            {
+                result += digits.substr(0, digits.length() - decimals);
+                result += '.';
+                result += digits.substr(digits.length() - decimals);
+            }
+            return result;
+        }
+    } // namespace
+
+    void trim(Limbs& a)
+    {
+        while (not a.empty() and a.back() == 0)
+            a.pop_back();
+    }
+
+    std::strong_ordering compareMagnitude(const Limbs& a, const Limbs& b)
+    {
+        if (a.size() != b.size())
+            return a.size() <=> b.size();
+        for (size_t i = a.size(); i-- > 0;)
+            if (a[i] != b[i])
+                return a[i] <=> b[i];
+        return std::strong_ordering::equal;
+    }
+
+    Limbs addMagnitude(const Limbs& a, const Limbs& b)
+    {
+        const Limbs& longer = a.size() >= b.size() ? a : b;
+        const Limbs& shorter = a.size() >= b.size() ? b : a;
+
+        Limbs result;
+        result.reserve(longer.size() + 1);
+        Limb carry = 0;
+        for (size_t i = 0; i < longer.size(); i++)
+        {
+            Limb sum = longer[i] + carry + (i < shorter.size() ? shorter[i] : 0);
+            carry = sum >= LIMB_BASE ? 1 : 0;
+            if (carry != 0)
+                sum -= LIMB_BASE;
+            result.push_back(sum);
+        }
+        if (carry != 0)
+            result.push_back(carry);
+        return result;
+    }
+
+    Limbs subtractMagnitude(const Limbs& a, const Limbs& b)
+    {
+        Limbs result;
+        result.reserve(a.size());
+        Limb borrow = 0;
+        for (size_t i = 0; i < a.size(); i++)
+        {
+            const Limb subtrahend = (i < b.size() ? b[i] : 0) + borrow;
+            if (a[i] >= subtrahend)
+            {
+                result.push_back(a[i] - subtrahend);
+                borrow = 0;
+            }
+            else
+            {
+                result.push_back(a[i] + LIMB_BASE - subtrahend);
+                borrow = 1;
+            }
+        }
+        trim(result);
+        return result;
+    }
+
+    void multiplySmall(Limbs& a, const Limb factor, const Limb addend)
+    {
+        std::uint64_t carry = addend;
+        for (auto& limb : a)
+        {
+            const std::uint64_t current = static_cast<std::uint64_t>(limb) * factor + carry;
+            limb = static_cast<Limb>(current % LIMB_BASE);
+            carry = current / LIMB_BASE;
+        }
+        while (carry != 0)
+        {
+            a.push_back(static_cast<Limb>(carry % LIMB_BASE));
+            carry /= LIMB_BASE;
+        }
+        trim(a);
+    }
+
+    Limb divideSmall(Limbs& a, const Limb divisor)
+    {
+        std::uint64_t remainder = 0;
+        for (size_t i = a.size(); i-- > 0;)
+        {
+            const std::uint64_t current = remainder * LIMB_BASE + a[i];
+            a[i] = static_cast<Limb>(current / divisor);
+            remainder = current % divisor;
+        }
+        trim(a);
+        return static_cast<Limb>(remainder);
+    }
+
+    Limbs shiftLeftDigits(const Limbs& a, const long long digits)
+    {
+        if (a.empty() or digits <= 0)
+            return a;
+
+        Limbs result;
+        const auto limbShift = static_cast<size_t>(digits / LIMB_DIGITS);
+        result.reserve(a.size() + limbShift + 1);
+        result.resize(limbShift, 0);
+        result.insert(result.end(), a.begin(), a.end());
+        if (const auto digitShift = digits % LIMB_DIGITS; digitShift != 0)
+            multiplySmall(result, POW10[digitShift]);
+        return result;
+    }
+
+    long long countDigits(const Limbs& a)
+    {
+        if (a.empty())
+            return 0;
+        long long digits = static_cast<long long>(a.size() - 1) * LIMB_DIGITS;
+        for (Limb top = a.back(); top != 0; top /= 10)
+            digits++;
+        return digits;
+    }
+
+    long long countTrailingZeros(const Limbs& a)
+    {
+        long long zeros = 0;
+        for (const auto limb : a)
+        {
+            if (limb == 0)
+            {
+                zeros += LIMB_DIGITS;
+                continue;
+            }
+            for (Limb current = limb; current % 10 == 0; current /= 10)
+                zeros++;
+            break;
+        }
+        return zeros;
+    }
+
+    bool parse(const std::string_view string, BigDecimal& out)
+    {
+        size_t start = 0;
+        bool negative = false;
+        while (start < string.size() and (string[start] == '-' or string[start] == '+'))
+        {
+            if (string[start] == '-')
+                negative = not negative;
+            start++;
+        }
+
+        size_t digitCount = 0;
+        size_t pointPos = std::string_view::npos;
+        for (size_t i = start; i < string.size(); i++)
+        {
+            if (string[i] == '.' and pointPos == std::string_view::npos)
+                pointPos = i;
+            else if (string[i] >= '0' and string[i] <= '9')
+                digitCount++;
+            else
+                return false;
+        }
+        if (digitCount == 0)
+            return false;
+
+        out.mantissa.clear();
+        out.mantissa.reserve((digitCount / LIMB_DIGITS) + 1);
+        out.exponent = pointPos == std::string_view::npos ? 0 : -static_cast<long long>(string.size() - pointPos - 1);
+
+        Limb current = 0;
+        long long filled = 0;
+        for (size_t i = string.size(); i-- > start;)
+        {
+            if (i == pointPos)
+                continue;
+            current += static_cast<Limb>(string[i] - '0') * POW10[filled];
+            if (++filled == LIMB_DIGITS)
+            {
+                out.mantissa.push_back(current);
+                current = 0;
+                filled = 0;
+            }
+        }
+        if (filled != 0)
+            out.mantissa.push_back(current);
+        trim(out.mantissa);
+        out.negative = negative and not out.mantissa.empty();
+        return true;
+    }
+
+    std::string toString(const BigDecimal& number)
+    {
+        std::string digits;
+        if (number.mantissa.empty())
+            digits = "0";
+        else
+        {
+            digits.reserve(static_cast<size_t>(number.mantissa.size() * LIMB_DIGITS));
+            char buffer[LIMB_DIGITS + 1];
+            auto [end, _] = std::to_chars(buffer, buffer + LIMB_DIGITS + 1, number.mantissa.back());
+            digits.append(buffer, end);
+            for (size_t i = number.mantissa.size() - 1; i-- > 0;)
+            {
+                auto [limbEnd, _] = std::to_chars(buffer, buffer + LIMB_DIGITS + 1, number.mantissa[i]);
+                digits.append(static_cast<size_t>(LIMB_DIGITS - (limbEnd - buffer)), '0');
+                digits.append(buffer, limbEnd);
+            }
+        }
+        return placeDecimalPoint(digits, number.exponent, number.negative and not number.isZero());
+    }
+
+    std::string toString(const SmallDecimal& number)
+    {
+        char buffer[24];
+        auto [end, _] = std::to_chars(buffer, buffer + sizeof buffer, number.mantissa);
+        return placeDecimalPoint({ buffer, end }, number.exponent, number.negative and not number.isZero());
+    }
+
+    void rescale(BigDecimal& number, const long long exponent)
+    {
+        if (exponent >= number.exponent)
+            return;
+        number.mantissa = shiftLeftDigits(number.mantissa, number.exponent - exponent);
+        number.exponent = exponent;
+    }
+
+    void stripTrailingZeros(BigDecimal& number)
+    {
+        if (number.exponent >= 0)
+            return;
+        if (number.mantissa.empty())
+        {
+            number.exponent = 0;
+            return;
+        }
+
+        const long long zeros = std::min(countTrailingZeros(number.mantissa), -number.exponent);
+        if (zeros == 0)
+            return;
+        int dropped = 0;
+        number.mantissa = shiftRightDigits(number.mantissa, zeros, dropped);
+        number.exponent += zeros;
+    }
+
+    std::strong_ordering compare(const BigDecimal& a, const BigDecimal& b)
+    {
+        const int aSign = a.isZero() ? 0 : (a.negative ? -1 : 1);
+        const int bSign = b.isZero() ? 0 : (b.negative ? -1 : 1);
+        if (aSign != bSign)
+            return aSign <=> bSign;
+        if (aSign == 0)
+            return std::strong_ordering::equal;
+
+        const auto result = magnitudeOrdering(a, b);
+        return aSign > 0 ? result : 0 <=> result;
+    }
+
+    std::partial_ordering compare(const std::string_view a, const std::string_view b)
+    {
+        DecimalDigits aDigits;
+        DecimalDigits bDigits;
+        if (not splitDigits(a, aDigits) or not splitDigits(b, bDigits))
+            return std::partial_ordering::unordered;
+
+        const int aSign = aDigits.isZero() ? 0 : (aDigits.negative ? -1 : 1);
+        const int bSign = bDigits.isZero() ? 0 : (bDigits.negative ? -1 : 1);
+        if (aSign != bSign)
+            return aSign <=> bSign;
+        if (aSign == 0)
+            return std::partial_ordering::equivalent;
+
+        // Without leading zeros, the longer integer part is larger. Without trailing zeros, the fractional parts
+        // compare lexicographically.
+        auto result = aDigits.integer.size() <=> bDigits.integer.size();
+        if (result == 0)
+            result = aDigits.integer.compare(bDigits.integer) <=> 0;
+        if (result == 0)
+            result = aDigits.fraction.compare(bDigits.fraction) <=> 0;
+        return aSign > 0 ? result : 0 <=> result;
+    }
+
+    BigDecimal add(const BigDecimal& a, const BigDecimal& b)
+    {
+        if (a.exponent != b.exponent)
+        {
+            // Align both operands to the smaller exponent, then add.
+            BigDecimal aligned = a.exponent > b.exponent ? a : b;
+            rescale(aligned, std::min(a.exponent, b.exponent));
+            return a.exponent > b.exponent ? add(aligned, b) : add(a, aligned);
+        }
+
+        BigDecimal result;
+        result.exponent = a.exponent;
+        if (a.negative == b.negative)
+        {
+            result.mantissa = addMagnitude(a.mantissa, b.mantissa);
+            result.negative = a.negative;
+        }
+        else if (compareMagnitude(a.mantissa, b.mantissa) >= 0)
+        {
+            result.mantissa = subtractMagnitude(a.mantissa, b.mantissa);
+            result.negative = a.negative;
+        }
+        else
+        {
+            result.mantissa = subtractMagnitude(b.mantissa, a.mantissa);
+            result.negative = b.negative;
+        }
+        result.negative = result.negative and not result.mantissa.empty();
+        return result;
+    }
+
+    BigDecimal subtract(const BigDecimal& a, const BigDecimal& b)
+    {
+        BigDecimal negated = b;
+        negated.negative = not b.negative and not b.isZero();
+        return add(a, negated);
+    }
+
+    BigDecimal multiply(const BigDecimal& a, const BigDecimal& b)
+    {
+        BigDecimal result;
+        result.mantissa = multiplyMagnitude(a.mantissa, b.mantissa);
+        result.exponent = a.exponent + b.exponent;
+        result.negative = (a.negative != b.negative) and not result.mantissa.empty();
+        return result;
+    }
+
+    BigDecimal roundOff(const BigDecimal& number, const long long decimals)
+    {
+        if (number.isInteger() or number.exponent == -decimals)
+            return number;
+
+        BigDecimal result = number;
+        if (number.exponent > -decimals)
+        {
+            rescale(result, -decimals);
+            return result;
+        }
+
+        int firstDropped = 0;
+        result.mantissa = shiftRightDigits(number.mantissa, -decimals - number.exponent, firstDropped);
+        result.exponent = -decimals;
+        if (firstDropped >= 5)
+            result.mantissa = addMagnitude(result.mantissa, { 1 });
+        result.negative = number.negative and not result.mantissa.empty();
+        return result;
+    }
+
+    double toDouble(const BigDecimal& number)
+    {
+        // Three limbs hold more digits than a double.
+        double result = 0;
+        const size_t used = std::min<size_t>(number.mantissa.size(), 3);
+        for (size_t i = 0; i < used; i++)
+            result = (result * LIMB_BASE) + number.mantissa[number.mantissa.size() - 1 - i];
+        const auto exponent =
+            number.exponent + (static_cast<long long>(number.mantissa.size() - used) * LIMB_DIGITS);
+        result *= std::pow(10.0, static_cast<double>(exponent));
+        return number.negative ? -result : result;
+    }
+} // namespace steppable::__internals::bignum
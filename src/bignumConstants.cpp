@@ -0,0 +1,202 @@
+/**************************************************************************************************
+ * Copyright (c) 2023-2025 NWSOFT                                                                 *
+ *                                                                                                *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy                   *
+ * of this software and associated documentation files (the "Software"), to deal                  *
+ * in the Software without restriction, including without limitation the rights                   *
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell                      *
+ * copies of the Software, and to permit persons to whom the Software is                          *
+ * furnished to do so, subject to the following conditions:                                       *
+ *                                                                                                *
+ * The above copyright notice and this permission notice shall be included in all                 *
+ * copies or substantial portions of the Software.                                                *
+ *                                                                                                *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR                     *
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,                       *
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE                    *
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER                         *
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,                  *
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE                  *
+ * SOFTWARE.                                                                                      *
+ **************************************************************************************************/
+
+/**
+ * @file bignumConstants.cpp
+ * @brief This file contains the mathematical constants of the limb-based backend, calculated to any precision.
+ *
+ * @author Andy Zhang
+ * @date 16th October 2026
+ */
+
+#include "bignum.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <mutex>
+
+namespace steppable::__internals::bignum
+{
+    namespace
+    {
+        /// @brief Extra digits kept in the cache, so that the cached value can be rounded correctly.
+        constexpr long long GUARD_DIGITS = 10;
+
+        /// @brief 640320^3 / 24, the denominator of the Chudnovsky series.
+        constexpr long long CHUDNOVSKY_C3_OVER_24 = 10'939'058'860'032'000;
+
+        /**
+         * @brief Calculates atanh(1 / m) = sum 1 / ((2k + 1) * m^(2k + 1)).
+         *
+         * @param m The reciprocal of the argument, at least 2.
+         * @param decimals The number of decimal places of the result.
+         * @return The result, truncated to `decimals` places.
+         */
+        BigDecimal atanhInverse(const long long m, const long long decimals)
+        {
+            const auto terms =
+                static_cast<long long>(static_cast<double>(decimals) / (2 * std::log10(static_cast<double>(m)))) + 2;
+            const HypergeometricSeries series{
+                .b = [](const long long k) { return fromInteger((2 * k) + 1); },
+                .p = [](long long) { return fromInteger(1); },
+                .q = [m](const long long k) { return fromInteger(k == 0 ? m : m * m); },
+            };
+            return sumSeries(series, terms, decimals);
+        }
+
+        /**
+         * @brief Calculates pi with the Chudnovsky series.
+         * @details pi = 426880 sqrt(10005) / sum (-1)^k (6k)! (13591409 + 545140134k) / ((3k)! (k!)^3 640320^(3k)),
+         * which gains about 14 digits per term.
+         *
+         * @param decimals The number of decimal places of the result.
+         * @return Pi, accurate to `decimals` places.
+         */
+        BigDecimal calculatePi(const long long decimals)
+        {
+            const long long working = decimals + 3;
+            const auto terms = static_cast<long long>(static_cast<double>(working) / 14.18) + 2;
+            const HypergeometricSeries series{
+                .a = [](const long long k) { return fromInteger(13'591'409 + (545'140'134 * k)); },
+                .p = [](const long long k) {
+                    if (k == 0)
+                        return fromInteger(1);
+                    auto result = multiply(fromInteger(((6 * k) - 5) * ((2 * k) - 1)), fromInteger((6 * k) - 1));
+                    result.negative = true;
+                    return result;
+                },
+                .q = [](const long long k) {
+                    return k == 0 ? fromInteger(1)
+                                  : multiply(fromInteger(k * k * k), fromInteger(CHUDNOVSKY_C3_OVER_24));
+                },
+            };
+            const auto numerator = multiply(fromInteger(426'880), squareRoot(fromInteger(10'005), working));
+            return roundOff(divideTruncated(numerator, sumSeries(series, terms, working), working), decimals);
+        }
+
+        /**
+         * @brief Calculates e = sum 1 / k!.
+         *
+         * @param decimals The number of decimal places of the result.
+         * @return e, accurate to `decimals` places.
+         */
+        BigDecimal calculateE(const long long decimals)
+        {
+            const long long working = decimals + 3;
+            long long terms = 1;
+            for (double logFactorial = 0; logFactorial < static_cast<double>(working); terms++)
+                logFactorial += std::log10(static_cast<double>(terms));
+
+            const HypergeometricSeries series{
+                .p = [](long long) { return fromInteger(1); },
+                .q = [](const long long k) { return fromInteger(std::max(k, 1LL)); },
+            };
+            return roundOff(sumSeries(series, terms + 1, working), decimals);
+        }
+
+        /**
+         * @brief Calculates ln(2) = 18 atanh(1/26) - 2 atanh(1/4801) + 8 atanh(1/8749).
+         *
+         * @param decimals The number of decimal places of the result.
+         * @return ln(2), accurate to `decimals` places.
+         */
+        BigDecimal calculateLn2(const long long decimals)
+        {
+            const long long working = decimals + 3;
+            auto result = multiply(fromInteger(18), atanhInverse(26, working));
+            result = subtract(result, multiply(fromInteger(2), atanhInverse(4801, working)));
+            result = add(result, multiply(fromInteger(8), atanhInverse(8749, working)));
+            return roundOff(result, decimals);
+        }
+
+        /**
+         * @brief Calculates ln(10) = 3 ln(2) + 2 atanh(1/9).
+         *
+         * @param decimals The number of decimal places of the result.
+         * @return ln(10), accurate to `decimals` places.
+         */
+        BigDecimal calculateLn10(const long long decimals)
+        {
+            const long long working = decimals + 3;
+            const auto result = add(multiply(fromInteger(3), calculateLn2(working)),
+                                    multiply(fromInteger(2), atanhInverse(9, working)));
+            return roundOff(result, decimals);
+        }
+
+        /**
+         * @struct ConstantCache
+         * @brief The most precise value of a constant calculated so far.
+         */
+        struct ConstantCache
+        {
+            std::mutex mutex; ///< Guards the value, as several threads may ask for the constant at once.
+            BigDecimal value; ///< The value of the constant.
+            long long decimals = -1; ///< The number of decimal places of the value.
+        };
+
+        /**
+         * @brief Looks up a constant, calculating it only when the cached value is not precise enough.
+         * @details Less precise requests round the cached value off. The lock is held while calculating, so threads
+         * asking for the same constant at once wait for a single calculation.
+         *
+         * @param cache The cache of the constant.
+         * @param decimals The number of decimal places needed.
+         * @param calculate Calculates the constant to a given number of decimal places.
+         * @return The constant, rounded to `decimals` places.
+         */
+        BigDecimal cachedConstant(ConstantCache& cache, const long long decimals, BigDecimal (*calculate)(long long))
+        {
+            const std::scoped_lock lock(cache.mutex);
+            if (cache.decimals < decimals + GUARD_DIGITS)
+            {
+                // Grow at least twofold, so that slowly increasing requests do not recalculate every time.
+                cache.decimals = std::max(decimals + GUARD_DIGITS, 2 * cache.decimals);
+                cache.value = calculate(cache.decimals);
+            }
+            return roundOff(cache.value, decimals);
+        }
+    } // namespace
+
+    BigDecimal pi(const long long decimals)
+    {
+        static ConstantCache cache;
+        return cachedConstant(cache, decimals, calculatePi);
+    }
+
+    BigDecimal e(const long long decimals)
+    {
+        static ConstantCache cache;
+        return cachedConstant(cache, decimals, calculateE);
+    }
+
+    BigDecimal ln2(const long long decimals)
+    {
+        static ConstantCache cache;
+        return cachedConstant(cache, decimals, calculateLn2);
+    }
+
+    BigDecimal ln10(const long long decimals)
+    {
+        static ConstantCache cache;
+        return cachedConstant(cache, decimals, calculateLn10);
+    }
+} // namespace steppable::__internals::bignum
@@ -0,0 +1,272 @@
+/**************************************************************************************************
+ * Copyright (c) 2023-2025 NWSOFT                                                                 *
+ *                                                                                                *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy                   *
+ * of this software and associated documentation files (the "Software"), to deal                  *
+ * in the Software without restriction, including without limitation the rights                   *
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell                      *
+ * copies of the Software, and to permit persons to whom the Software is                          *
+ * furnished to do so, subject to the following conditions:                                       *
+ *                                                                                                *
+ * The above copyright notice and this permission notice shall be included in all                 *
+ * copies or substantial portions of the Software.                                                *
+ *                                                                                                *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR                     *
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,                       *
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE                    *
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER                         *
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,                  *
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE                  *
+ * SOFTWARE.                                                                                      *
+ **************************************************************************************************/
+
+/**
+ * @file bignumDivide.cpp
+ * @brief This file contains the division engines of the limb-based backend.
+ *
+ * @author Andy Zhang
+ * @date 16th October 2026
+ */
+
+#include "bignum.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <utility>
+
+namespace steppable::__internals::bignum
+{
+    namespace
+    {
+        /// @brief Divisors up to this many limbs have their reciprocals computed with algorithm D directly.
+        constexpr size_t NEWTON_BASECASE = 16;
+
+        /**
+         * @brief Creates the magnitude B^exponent, where B is the limb base.
+         *
+         * @param exponent The power of the limb base.
+         * @return The magnitude.
+         */
+        Limbs limbPower(const size_t exponent)
+        {
+            Limbs result(exponent + 1, 0);
+            result.back() = 1;
+            return result;
+        }
+
+        /**
+         * @brief Drops the lowest limbs of a magnitude, dividing it by a power of the limb base.
+         *
+         * @param a The magnitude.
+         * @param limbs The number of limbs to drop.
+         * @return The shifted magnitude.
+         */
+        Limbs shiftRightLimbs(const Limbs& a, const size_t limbs)
+        {
+            if (limbs >= a.size())
+                return {};
+            return { a.begin() + static_cast<long>(limbs), a.end() };
+        }
+
+        /**
+         * @brief Computes the reciprocal of a normalized magnitude, floor(B^(2h) / v), where h is the length of v.
+         * @details The top half of v is inverted recursively. One Newton step, x + x * (B^(2h) - v * x) / B^(2h),
+         * then doubles the precision, and the last few units are corrected exactly.
+         *
+         * @param v The magnitude, whose top limb is at least B / 2.
+         * @return The reciprocal.
+         */
+        Limbs reciprocal(const Limbs& v)
+        {
+            const size_t h = v.size();
+            const Limbs target = limbPower(2 * h);
+            if (h <= NEWTON_BASECASE)
+                return divideKnuth(target, v).quotient;
+
+            // Two extra limbs keep the error of the Newton step below one unit.
+            const size_t l = (h / 2) + 2;
+            Limbs x = reciprocal(Limbs(v.end() - static_cast<long>(l), v.end()));
+            x.insert(x.begin(), h - l, 0);
+
+            Limbs product = multiplyMagnitude(v, x);
+            if (compareMagnitude(product, target) <= 0)
+            {
+                const auto error = subtractMagnitude(target, product);
+                x = addMagnitude(x, shiftRightLimbs(multiplyMagnitude(x, error), 2 * h));
+            }
+            else
+            {
+                const auto error = subtractMagnitude(product, target);
+                x = subtractMagnitude(x, shiftRightLimbs(multiplyMagnitude(x, error), 2 * h));
+            }
+
+            product = multiplyMagnitude(v, x);
+            while (compareMagnitude(product, target) > 0)
+            {
+                x = subtractMagnitude(x, { 1 });
+                product = subtractMagnitude(product, v);
+            }
+            while (compareMagnitude(subtractMagnitude(target, product), v) >= 0)
+            {
+                x = addMagnitude(x, { 1 });
+                product = addMagnitude(product, v);
+            }
+            return x;
+        }
+    } // namespace
+
+    LimbQuotientRemainder divideMagnitude(const Limbs& a, const Limbs& b)
+    {
+        if (b.size() >= NEWTON_DIVISION_THRESHOLD and a.size() >= b.size() + NEWTON_DIVISION_THRESHOLD)
+            return divideNewton(a, b);
+        return divideKnuth(a, b);
+    }
+
+    LimbQuotientRemainder divideKnuth(const Limbs& a, const Limbs& b)
+    {
+        if (compareMagnitude(a, b) < 0)
+            return { {}, a };
+        if (b.size() == 1)
+        {
+            Limbs quotient = a;
+            const Limb remainder = divideSmall(quotient, b[0]);
+            return { std::move(quotient), remainder == 0 ? Limbs{} : Limbs{ remainder } };
+        }
+
+        // Normalize so that the top limb of the divisor is at least B / 2. This keeps every estimated quotient limb
+        // at most two above the real one.
+        const Limb factor = LIMB_BASE / (b.back() + 1);
+        Limbs u = a;
+        Limbs v = b;
+        multiplySmall(u, factor);
+        multiplySmall(v, factor);
+        u.resize(a.size() + 1, 0);
+
+        const size_t n = v.size();
+        const size_t m = a.size() - n;
+        Limbs quotient(m + 1, 0);
+        for (size_t j = m + 1; j-- > 0;)
+        {
+            const std::uint64_t numerator = (static_cast<std::uint64_t>(u[j + n]) * LIMB_BASE) + u[j + n - 1];
+            std::uint64_t estimate = numerator / v[n - 1];
+            std::uint64_t estimateRemainder = numerator % v[n - 1];
+            if (estimate >= LIMB_BASE)
+            {
+                estimate = LIMB_BASE - 1;
+                estimateRemainder = numerator - (estimate * v[n - 1]);
+            }
+            while (estimateRemainder < LIMB_BASE and
+                   estimate * v[n - 2] > (estimateRemainder * LIMB_BASE) + u[j + n - 2])
+            {
+                estimate--;
+                estimateRemainder += v[n - 1];
+            }
+
+            // Multiply and subtract.
+            std::uint64_t carry = 0;
+            std::int64_t borrow = 0;
+            for (size_t i = 0; i < n; i++)
+            {
+                const std::uint64_t product = (estimate * v[i]) + carry;
+                carry = product / LIMB_BASE;
+                const std::int64_t difference =
+                    static_cast<std::int64_t>(u[i + j]) - static_cast<std::int64_t>(product % LIMB_BASE) + borrow;
+                borrow = difference < 0 ? -1 : 0;
+                u[i + j] = static_cast<Limb>(difference < 0 ? difference + LIMB_BASE : difference);
+            }
+            const std::int64_t top = static_cast<std::int64_t>(u[j + n]) - static_cast<std::int64_t>(carry) + borrow;
+            u[j + n] = static_cast<Limb>(top < 0 ? top + LIMB_BASE : top);
+
+            // The estimate was one too large, add the divisor back.
+            if (top < 0)
+            {
+                estimate--;
+                Limb addCarry = 0;
+                for (size_t i = 0; i < n; i++)
+                {
+                    Limb sum = u[i + j] + v[i] + addCarry;
+                    addCarry = sum >= LIMB_BASE ? 1 : 0;
+                    u[i + j] = addCarry != 0 ? sum - LIMB_BASE : sum;
+                }
+                u[j + n] = (u[j + n] + addCarry) % LIMB_BASE;
+            }
+            quotient[j] = static_cast<Limb>(estimate);
+        }
+
+        trim(quotient);
+        u.resize(n);
+        trim(u);
+        divideSmall(u, factor);
+        return { std::move(quotient), std::move(u) };
+    }
+
+    LimbQuotientRemainder divideNewton(const Limbs& a, const Limbs& b)
+    {
+        if (compareMagnitude(a, b) < 0)
+            return { {}, a };
+
+        const Limb factor = LIMB_BASE / (b.back() + 1);
+        Limbs u = a;
+        Limbs v = b;
+        multiplySmall(u, factor);
+        multiplySmall(v, factor);
+
+        // Divide chunk by chunk, n limbs at a time, so that every partial dividend is below B^(2n).
+        const size_t n = v.size();
+        const auto inverse = reciprocal(v);
+        const size_t chunks = (u.size() + n - 1) / n;
+        Limbs quotient(chunks * n, 0);
+        Limbs remainder;
+        for (size_t chunk = chunks; chunk-- > 0;)
+        {
+            Limbs current(n, 0);
+            for (size_t i = 0; i < n and (chunk * n) + i < u.size(); i++)
+                current[i] = u[(chunk * n) + i];
+            current.insert(current.end(), remainder.begin(), remainder.end());
+            trim(current);
+
+            auto partialQuotient = shiftRightLimbs(multiplyMagnitude(current, inverse), 2 * n);
+            remainder = subtractMagnitude(current, multiplyMagnitude(partialQuotient, v));
+            while (compareMagnitude(remainder, v) >= 0)
+            {
+                remainder = subtractMagnitude(remainder, v);
+                partialQuotient = addMagnitude(partialQuotient, { 1 });
+            }
+            std::ranges::copy(partialQuotient, quotient.begin() + static_cast<long>(chunk * n));
+        }
+
+        trim(quotient);
+        divideSmall(remainder, factor);
+        return { std::move(quotient), std::move(remainder) };
+    }
+
+    BigDecimal divideTruncated(const BigDecimal& a, const BigDecimal& b, const long long decimals)
+    {
+        // |a / b| * 10^decimals = (ma / mb) * 10^(ea - eb + decimals)
+        const long long shift = a.exponent - b.exponent + decimals;
+        const auto numerator = shift >= 0 ? shiftLeftDigits(a.mantissa, shift) : a.mantissa;
+        const auto denominator = shift < 0 ? shiftLeftDigits(b.mantissa, -shift) : b.mantissa;
+
+        BigDecimal result;
+        result.mantissa = divideMagnitude(numerator, denominator).quotient;
+        result.exponent = -decimals;
+        result.negative = a.negative != b.negative and not result.mantissa.empty();
+        return result;
+    }
+
+    BigDecimal divideRounded(const BigDecimal& a, const BigDecimal& b, const long long decimals)
+    {
+        // Keep one more digit for rounding.
+        auto result = divideTruncated(a, b, decimals + 1);
+        const Limb lastDigit = divideSmall(result.mantissa, 10);
+        result.exponent = -decimals;
+
+        // Results below 10^-decimals are reported as 0.
+        if (decimals > 0 and result.mantissa.empty())
+            return {};
+        if (decimals > 0 and lastDigit >= 5)
+            result.mantissa = addMagnitude(result.mantissa, { 1 });
+        result.negative = result.negative and not result.mantissa.empty();
+        return result;
+    }
+} // namespace steppable::__internals::bignum
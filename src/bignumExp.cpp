@@ -0,0 +1,233 @@
+/**************************************************************************************************
+ * Copyright (c) 2023-2025 NWSOFT                                                                 *
+ *                                                                                                *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy                   *
+ * of this software and associated documentation files (the "Software"), to deal                  *
+ * in the Software without restriction, including without limitation the rights                   *
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell                      *
+ * copies of the Software, and to permit persons to whom the Software is                          *
+ * furnished to do so, subject to the following conditions:                                       *
+ *                                                                                                *
+ * The above copyright notice and this permission notice shall be included in all                 *
+ * copies or substantial portions of the Software.                                                *
+ *                                                                                                *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR                     *
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,                       *
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE                    *
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER                         *
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,                  *
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE                  *
+ * SOFTWARE.                                                                                      *
+ **************************************************************************************************/
+
+/**
+ * @file bignumExp.cpp
+ * @brief This file contains the exponential and logarithmic functions of the limb-based backend.
+ *
+ * @author Andy Zhang
+ * @date 16th October 2026
+ */
+
+#include "bignum.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <utility>
+#include <vector>
+
+namespace steppable::__internals::bignum
+{
+    namespace
+    {
+        /// @brief Extra digits carried through the calculation, so that the result can be rounded correctly.
+        constexpr long long GUARD_DIGITS = 10;
+
+        /**
+         * @brief Calculates exp(r) for 0 <= r < 1 as the product of the exponentials of r's digit groups.
+         *
+         * @param r The argument.
+         * @param decimals The number of decimal places of the result.
+         * @return exp(r), accurate to a few units in the last place.
+         */
+        BigDecimal expReduced(const BigDecimal& r, const long long decimals)
+        {
+            auto result = fromInteger(1);
+            for (const auto& [numerator, end] : splitDigitGroups(r, decimals))
+            {
+                const HypergeometricSeries series{
+                    .p = [&numerator](const long long k) { return k == 0 ? fromInteger(1) : numerator; },
+                    .q = [end](const long long k) {
+                        return k == 0 ? fromInteger(1) : BigDecimal{ .mantissa = { static_cast<Limb>(k) },
+                                                                     .exponent = end };
+                    },
+                };
+                const auto terms = taylorTerms({ .numerator = numerator, .end = end }, decimals) + 1;
+                result = roundOff(multiply(result, sumSeries(series, terms, decimals)), decimals);
+            }
+            return result;
+        }
+    } // namespace
+
+    BigDecimal power(const BigDecimal& base, const unsigned long long exponent)
+    {
+        if (exponent == 0)
+            return fromInteger(1);
+
+        // Left to right with a sliding window. The odd powers up to base^(2^width - 1) are calculated first, so that a
+        // run of up to `width` bits costs one multiplication instead of one for every set bit.
+        const int bits = std::bit_width(exponent);
+        const int width = bits <= 8 ? 1 : bits <= 24 ? 3 : bits <= 48 ? 4 : 5;
+        std::vector<BigDecimal> oddPowers{ base };
+        if (width > 1)
+        {
+            const auto square = multiply(base, base);
+            for (size_t i = 1; i < (1ULL << (width - 1)); i++)
+                oddPowers.push_back(multiply(oddPowers.back(), square));
+        }
+
+        BigDecimal result;
+        bool started = false;
+        for (int bit = bits - 1; bit >= 0;)
+        {
+            if (((exponent >> bit) & 1) == 0)
+            {
+                result = multiply(result, result);
+                bit--;
+                continue;
+            }
+
+            // The window starts at this bit and ends at the lowest set bit within reach.
+            int low = std::max(bit - width + 1, 0);
+            while (((exponent >> low) & 1) == 0)
+                low++;
+            const auto window = (exponent >> low) & ((1ULL << (bit - low + 1)) - 1);
+            if (started)
+            {
+                for (int i = low; i <= bit; i++)
+                    result = multiply(result, result);
+                result = multiply(result, oddPowers[window / 2]);
+            }
+            else
+                result = oddPowers[window / 2];
+            started = true;
+            bit = low - 1;
+        }
+        return result;
+    }
+
+    BigDecimal power(const BigDecimal& base, const long long exponent, const long long decimals)
+    {
+        if (exponent >= 0)
+            return roundOff(power(base, static_cast<unsigned long long>(exponent)), decimals);
+        // base^-n = 1 / base^n, so the only division comes at the end.
+        return divideRounded(fromInteger(1), power(base, 0ULL - static_cast<unsigned long long>(exponent)), decimals);
+    }
+
+    BigDecimal exp(const BigDecimal& x, const long long decimals)
+    {
+        if (x.isZero())
+            return fromInteger(1);
+
+        // e^x < 10^-(decimals + 1) rounds off to zero.
+        const auto underflow = static_cast<long long>(static_cast<double>(decimals + 1) * std::log(10.0)) + 1;
+        if (compare(x, fromInteger(-underflow)) < 0)
+            return { .exponent = -decimals };
+
+        // x = k * ln(2) + r, where 0 <= r < ln(2). A rough ln(2) is enough to find k.
+        const long long integerDigits = std::max(countDigits(x.mantissa) + x.exponent, 1LL);
+        auto k = divideTruncated(x, ln2(integerDigits + GUARD_DIGITS), 0);
+        if (x.negative)
+            k = subtract(k, fromInteger(1));
+        SmallDecimal kValue;
+        narrow(k, kValue);
+        long long shift =
+            kValue.negative ? -static_cast<long long>(kValue.mantissa) : static_cast<long long>(kValue.mantissa);
+
+        // e^x has about k * log10(2) integer digits, all of which have to be correct too.
+        const long long working =
+            decimals + GUARD_DIGITS + std::max(0LL, static_cast<long long>(static_cast<double>(shift) * std::log10(2.0)));
+        const auto precise = ln2(working + integerDigits);
+        auto r = roundOff(subtract(x, multiply(k, precise)), working);
+        if (r.negative)
+        {
+            r = add(r, precise);
+            shift--;
+        }
+
+        const auto expR = expReduced(r, working);
+        const auto scale = power(fromInteger(2), static_cast<unsigned long long>(shift >= 0 ? shift : -shift));
+        if (shift >= 0)
+            return roundOff(multiply(expR, scale), decimals);
+        return roundOff(divideTruncated(expR, scale, working), decimals);
+    }
+
+    BigDecimal lnNewton(const BigDecimal& x, const long long decimals)
+    {
+        // Each step triples the number of correct digits, so the earlier steps run at a third of the precision.
+        std::vector<long long> precisions;
+        for (long long precision = decimals + 2; precision > 14; precision = (precision / 3) + 2)
+            precisions.push_back(precision);
+
+        auto result = fromInteger(std::llround(std::log(toDouble(x)) * 1e15));
+        result.exponent = -15;
+        const auto two = fromInteger(2);
+        for (auto precision = precisions.rbegin(); precision != precisions.rend(); ++precision)
+        {
+            // y = y + 2 * (x - exp(y)) / (x + exp(y))
+            const auto expResult = exp(result, *precision);
+            const auto correction =
+                divideTruncated(multiply(two, subtract(x, expResult)), add(x, expResult), *precision);
+            result = roundOff(add(result, correction), *precision);
+        }
+        return roundOff(result, decimals);
+    }
+
+    BigDecimal lnAGM(const BigDecimal& x, const long long decimals)
+    {
+        // ln(s) = pi / (2 AGM(1, 4 / s)) to about 2 log10(s) digits, so s = x * 2^m has to exceed 10^(decimals / 2).
+        const auto shift =
+            static_cast<long long>(static_cast<double>((decimals / 2) + 2) * std::log2(10.0)) + 1;
+        // 4 / s needs as many significant digits as the result, and the AGM loses about 2 log10(decimals) more to
+        // the size of ln(s).
+        const auto s = multiply(x, power(fromInteger(2), static_cast<unsigned long long>(shift)));
+        const long long working = decimals + GUARD_DIGITS + countDigits(s.mantissa) + s.exponent +
+                                  (2 * countDigits(fromInteger(decimals).mantissa));
+
+        auto a = fromInteger(1);
+        auto b = divideTruncated(fromInteger(4), s, working);
+        const BigDecimal tolerance{ .mantissa = { 1 }, .exponent = -working };
+        const BigDecimal half{ .mantissa = { 5 }, .exponent = -1 };
+        while (true)
+        {
+            auto difference = subtract(a, b);
+            difference.negative = false;
+            if (compare(difference, tolerance) <= 0)
+                break;
+            auto nextA = roundOff(multiply(add(a, b), half), working);
+            b = squareRoot(multiply(a, b), working);
+            a = std::move(nextA);
+        }
+
+        const auto lnS = divideTruncated(pi(working), multiply(fromInteger(2), a), working);
+        const auto mLn2 = multiply(fromInteger(shift), ln2(working + countDigits(fromInteger(shift).mantissa)));
+        return roundOff(subtract(lnS, mLn2), decimals);
+    }
+
+    BigDecimal ln(const BigDecimal& x, const long long decimals)
+    {
+        // x = m * 10^k, where 1 <= m < 10, and ln(x) = ln(m) + k ln(10).
+        const long long k = countDigits(x.mantissa) + x.exponent - 1;
+        auto m = x;
+        m.exponent -= k;
+
+        const long long working = decimals + GUARD_DIGITS;
+        auto result = working < AGM_LOG_THRESHOLD ? lnNewton(m, working) : lnAGM(m, working);
+        if (k != 0)
+        {
+            const auto kNumber = fromInteger(k);
+            result = add(result, multiply(kNumber, ln10(working + countDigits(kNumber.mantissa))));
+        }
+        return roundOff(result, decimals);
+    }
+} // namespace steppable::__internals::bignum
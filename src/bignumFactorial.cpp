@@ -0,0 +1,183 @@
+/**************************************************************************************************
+ * Copyright (c) 2023-2025 NWSOFT                                                                 *
+ *                                                                                                *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy                   *
+ * of this software and associated documentation files (the "Software"), to deal                  *
+ * in the Software without restriction, including without limitation the rights                   *
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell                      *
+ * copies of the Software, and to permit persons to whom the Software is                          *
+ * furnished to do so, subject to the following conditions:                                       *
+ *                                                                                                *
+ * The above copyright notice and this permission notice shall be included in all                 *
+ * copies or substantial portions of the Software.                                                *
+ *                                                                                                *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR                     *
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,                       *
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE                    *
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER                         *
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,                  *
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE                  *
+ * SOFTWARE.                                                                                      *
+ **************************************************************************************************/
+
+/**
+ * @file bignumFactorial.cpp
+ * @brief This file contains the factorials and binomial coefficients of the limb-based backend.
+ *
+ * @author Andy Zhang
+ * @date 17th October 2026
+ */
+
+#include "bignum.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <utility>
+#include <vector>
+
+namespace steppable::__internals::bignum
+{
+    namespace
+    {
+        /// @brief Factorials up to this number fit in 64 bits, so they are multiplied out directly.
+        constexpr unsigned long long SMALL_FACTORIAL = 20;
+
+        /// @brief Binomial coefficients with k up to n / BINOMIAL_SIEVE_RATIO are calculated without a sieve.
+        constexpr unsigned long long BINOMIAL_SIEVE_RATIO = 32;
+
+        /**
+         * @brief Calculates the swinging factorial n! / (floor(n / 2)!)^2 from its prime factorization.
+         *
+         * @param n The number.
+         * @param primes The primes up to at least n.
+         * @return The swinging factorial of n.
+         */
+        BigDecimal swingingFactorial(const unsigned long long n, const std::vector<std::uint64_t>& primes)
+        {
+            // The exponent of p is the number of odd values among floor(n / p), floor(n / p^2), ...
+            std::vector<std::uint64_t> factors;
+            for (const auto p : primes)
+            {
+                if (p > n)
+                    break;
+                for (auto q = n / p; q != 0; q /= p)
+                    if (q % 2 == 1)
+                        factors.push_back(p);
+            }
+            return productTree(factors);
+        }
+
+        /**
+         * @brief Calculates n! = (floor(n / 2)!)^2 * swing(n) recursively, after Luschny.
+         *
+         * @param n The number.
+         * @param primes The primes up to at least n.
+         * @return n!.
+         */
+        // NOLINTNEXTLINE(*-no-recursion)
+        BigDecimal primeSwingFactorial(const unsigned long long n, const std::vector<std::uint64_t>& primes)
+        {
+            if (n <= SMALL_FACTORIAL)
+            {
+                std::uint64_t result = 1;
+                for (std::uint64_t i = 2; i <= n; i++)
+                    result *= i;
+                return fromInteger(result);
+            }
+            const auto half = primeSwingFactorial(n / 2, primes);
+            return multiply(multiply(half, half), swingingFactorial(n, primes));
+        }
+    } // namespace
+
+    std::vector<std::uint64_t> primesUpTo(const unsigned long long n)
+    {
+        std::vector<std::uint64_t> primes;
+        if (n < 2)
+            return primes;
+        primes.push_back(2);
+
+        // Only odd numbers are sieved; index i stands for 2i + 1.
+        std::vector<bool> composite((n + 1) / 2, false);
+        for (unsigned long long i = 1; i < composite.size(); i++)
+        {
+            if (composite[i])
+                continue;
+            const auto p = (2 * i) + 1;
+            primes.push_back(p);
+            for (auto multiple = p * p / 2; multiple < composite.size(); multiple += p)
+                composite[multiple] = true;
+        }
+        return primes;
+    }
+
+    BigDecimal productTree(const std::vector<std::uint64_t>& factors)
+    {
+        // Runs of small factors are packed into single words first, so that the tree starts from operands of equal
+        // size.
+        std::vector<BigDecimal> level;
+        std::uint64_t word = 1;
+        for (const auto factor : factors)
+        {
+            if (factor != 0 and word > std::numeric_limits<std::uint64_t>::max() / factor)
+            {
+                level.push_back(fromInteger(word));
+                word = 1;
+            }
+            word *= factor;
+        }
+        level.push_back(fromInteger(word));
+
+        // Neighbours are multiplied pairwise until a single product is left.
+        while (level.size() > 1)
+        {
+            std::vector<BigDecimal> next;
+            next.reserve((level.size() + 1) / 2);
+            for (size_t i = 0; i + 1 < level.size(); i += 2)
+                next.push_back(multiply(level[i], level[i + 1]));
+            if (level.size() % 2 == 1)
+                next.push_back(std::move(level.back()));
+            level = std::move(next);
+        }
+        return std::move(level.front());
+    }
+
+    BigDecimal factorial(const unsigned long long n)
+    {
+        if (n <= SMALL_FACTORIAL)
+            return primeSwingFactorial(n, {});
+        return primeSwingFactorial(n, primesUpTo(n));
+    }
+
+    BigDecimal binomial(const unsigned long long n, unsigned long long k)
+    {
+        if (k > n)
+            return {};
+        k = std::min(k, n - k);
+
+        // With few factors, n (n - 1) ... (n - k + 1) / k! is cheaper than sieving up to n.
+        if (k <= n / BINOMIAL_SIEVE_RATIO)
+        {
+            std::vector<std::uint64_t> numerator;
+            numerator.reserve(k);
+            for (unsigned long long i = 0; i < k; i++)
+                numerator.push_back(n - i);
+            return divideTruncated(productTree(numerator), factorial(k), 0);
+        }
+
+        // By Legendre's formula, the exponent of p is the sum of floor(n / p^j) - floor(k / p^j) - floor((n - k) / p^j)
+        // over j, which is the number of carries when adding k and n - k in base p.
+        std::vector<std::uint64_t> factors;
+        for (const auto p : primesUpTo(n))
+        {
+            for (unsigned long long power = p;; power *= p)
+            {
+                for (auto count = (n / power) - (k / power) - ((n - k) / power); count != 0; count--)
+                    factors.push_back(p);
+                if (power > n / p)
+                    break;
+            }
+        }
+        return productTree(factors);
+    }
+} // namespace steppable::__internals::bignum
@@ -0,0 +1,280 @@
+/**************************************************************************************************
+ * Copyright (c) 2023-2025 NWSOFT                                                                 *
+ *                                                                                                *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy                   *
+ * of this software and associated documentation files (the "Software"), to deal                  *
+ * in the Software without restriction, including without limitation the rights                   *
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell                      *
+ * copies of the Software, and to permit persons to whom the Software is                          *
+ * furnished to do so, subject to the following conditions:                                       *
+ *                                                                                                *
+ * The above copyright notice and this permission notice shall be included in all                 *
+ * copies or substantial portions of the Software.                                                *
+ *                                                                                                *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR                     *
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,                       *
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE                    *
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER                         *
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,                  *
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE                  *
+ * SOFTWARE.                                                                                      *
+ **************************************************************************************************/
+
+/**
+ * @file bignumGcd.cpp
+ * @brief This file contains the greatest common divisor functions of the limb-based backend.
+ *
+ * @author Andy Zhang
+ * @date 17th October 2026
+ */
+
+#include "bignum.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <cstdint>
+#include <cstdlib>
+#include <numeric>
+#include <utility>
+
+namespace steppable::__internals::bignum
+{
+    namespace
+    {
+        /// @brief The number of leading digits Lehmer's algorithm looks at. Their value has to fit in 63 bits.
+        constexpr long long LEHMER_DIGITS = 18;
+
+        /// @brief Magnitudes with at most this many limbs fit in a 64-bit word.
+        constexpr size_t WORD_LIMBS = 2;
+
+        std::uint64_t toWord(const Limbs& a)
+        {
+            std::uint64_t result = 0;
+            for (size_t i = a.size(); i-- > 0;)
+                result = (result * LIMB_BASE) + a[i];
+            return result;
+        }
+
+        Limbs fromWord(const std::uint64_t value) { return fromInteger(value).mantissa; }
+
+        /**
+         * @brief Finishes a GCD once the smaller magnitude fits in a word.
+         *
+         * @param a The larger magnitude.
+         * @param b The smaller magnitude, at most two limbs.
+         * @return gcd(a, b).
+         */
+        Limbs finishWord(const Limbs& a, const Limbs& b)
+        {
+            if (b.empty())
+                return a;
+            const auto remainder = a.size() <= WORD_LIMBS ? a : divideMagnitude(a, b).remainder;
+            return fromWord(std::gcd(toWord(remainder), toWord(b)));
+        }
+
+        /**
+         * @brief Divides out the factors of two of a magnitude, in place.
+         *
+         * @param a The magnitude, must not be zero.
+         * @return The number of factors of two removed.
+         */
+        unsigned long long stripTwos(Limbs& a)
+        {
+            // 10^9 = 2^9 * 5^9, so the lowest limb decides divisibility by up to 2^9.
+            unsigned long long count = 0;
+            while ((a.front() & 1) == 0)
+            {
+                const int shift = a.front() == 0 ? 9 : std::min(std::countr_zero(a.front()), 9);
+                divideSmall(a, Limb{ 1 } << shift);
+                count += shift;
+            }
+            return count;
+        }
+
+        /**
+         * @brief Subtracts a smaller magnitude from a larger one, in place.
+         *
+         * @param a The larger magnitude. Holds the difference afterwards.
+         * @param b The smaller magnitude.
+         */
+        void subtractInPlace(Limbs& a, const Limbs& b)
+        {
+            long long borrow = 0;
+            for (size_t i = 0; i < a.size() and (i < b.size() or borrow != 0); i++)
+            {
+                long long current = static_cast<long long>(a[i]) - borrow - (i < b.size() ? b[i] : 0);
+                borrow = current < 0 ? 1 : 0;
+                if (current < 0)
+                    current += LIMB_BASE;
+                a[i] = static_cast<Limb>(current);
+            }
+            trim(a);
+        }
+
+        /**
+         * @brief Takes the leading digits of a magnitude.
+         *
+         * @param a The magnitude.
+         * @param shift The number of digits to drop, at least 0. At most 18 digits may remain.
+         * @return floor(a / 10^shift).
+         */
+        long long leadingDigits(const Limbs& a, const long long shift)
+        {
+            const auto limb = static_cast<size_t>(shift / LIMB_DIGITS);
+            const auto divisor = static_cast<std::uint64_t>(POW10[shift % LIMB_DIGITS]);
+            const auto at = [&a](const size_t i) -> std::uint64_t { return i < a.size() ? a[i] : 0; };
+
+            // floor((h * 10^18 + m * 10^9 + l) / d) = h * (10^18 / d) + floor((m * 10^9 + l) / d), as d divides 10^9.
+            constexpr std::uint64_t base = LIMB_BASE;
+            const auto low = ((at(limb + 1) * base) + at(limb)) / divisor;
+            return static_cast<long long>((at(limb + 2) * (base * base / divisor)) + low);
+        }
+
+        /**
+         * @brief Calculates p * a - q * b, which must not be negative.
+         *
+         * @param a The first magnitude.
+         * @param p The factor of a, less than the limb base.
+         * @param b The second magnitude.
+         * @param q The factor of b, less than the limb base.
+         * @return The combination.
+         */
+        Limbs combine(const Limbs& a, const long long p, const Limbs& b, const long long q)
+        {
+            Limbs result(std::max(a.size(), b.size()) + 1, 0);
+            long long carry = 0;
+            for (size_t i = 0; i < result.size(); i++)
+            {
+                const long long x = i < a.size() ? a[i] : 0;
+                const long long y = i < b.size() ? b[i] : 0;
+                long long current = (p * x) - (q * y) + carry;
+                carry = current / LIMB_BASE;
+                current %= LIMB_BASE;
+                if (current < 0)
+                {
+                    current += LIMB_BASE;
+                    carry--;
+                }
+                result[i] = static_cast<Limb>(current);
+            }
+            trim(result);
+            return result;
+        }
+
+        /**
+         * @brief Runs one step of Lehmer's algorithm.
+         * @details The Euclidean algorithm is simulated on the leading 18 digits for as long as the quotients are the
+         * same as the full numbers would give, and the collected steps are applied at once. If not even one step is
+         * certain, a full division is done instead.
+         *
+         * @param a The larger magnitude.
+         * @param b The smaller magnitude, with more than two limbs.
+         */
+        void lehmerStep(Limbs& a, Limbs& b)
+        {
+            const long long shift = std::max(countDigits(a) - LEHMER_DIGITS, 0LL);
+            long long x = leadingDigits(a, shift);
+            long long y = leadingDigits(b, shift);
+
+            // The quotients of (x + A) / (y + C) and (x + B) / (y + D) bound the quotient of the full numbers.
+            long long A = 1;
+            long long B = 0;
+            long long C = 0;
+            long long D = 1;
+            while (y + C > 0 and y + D > 0)
+            {
+                const long long quotient = (x + A) / (y + C);
+                if (quotient != (x + B) / (y + D))
+                    break;
+                const long long nextC = A - (quotient * C);
+                const long long nextD = B - (quotient * D);
+                if (std::max(std::abs(nextC), std::abs(nextD)) >= LIMB_BASE)
+                    break;
+                A = std::exchange(C, nextC);
+                B = std::exchange(D, nextD);
+                x = std::exchange(y, x - (quotient * y));
+            }
+
+            if (B == 0)
+            {
+                auto remainder = divideMagnitude(a, b).remainder;
+                a = std::move(b);
+                b = std::move(remainder);
+                return;
+            }
+
+            // The cofactors alternate in sign, so each new number is a difference of two multiples.
+            auto nextA = A >= 0 ? combine(a, A, b, -B) : combine(b, B, a, -A);
+            auto nextB = C >= 0 ? combine(a, C, b, -D) : combine(b, D, a, -C);
+            a = std::move(nextA);
+            b = std::move(nextB);
+        }
+    } // namespace
+
+    Limbs gcdMagnitude(const Limbs& a, const Limbs& b)
+    {
+        Limbs x = a;
+        Limbs y = b;
+        if (compareMagnitude(x, y) < 0)
+            std::swap(x, y);
+        while (y.size() >= LEHMER_GCD_THRESHOLD)
+            lehmerStep(x, y);
+        return gcdBinary(x, y);
+    }
+
+    Limbs gcdBinary(const Limbs& a, const Limbs& b)
+    {
+        if (a.empty())
+            return b;
+        if (b.empty())
+            return a;
+
+        Limbs x = a;
+        Limbs y = b;
+        const auto twos = std::min(stripTwos(x), stripTwos(y));
+        while (x.size() > WORD_LIMBS or y.size() > WORD_LIMBS)
+        {
+            // Both are odd here, so their difference is even.
+            if (compareMagnitude(x, y) < 0)
+                std::swap(x, y);
+            subtractInPlace(x, y);
+            if (x.empty())
+                break;
+            stripTwos(x);
+        }
+
+        auto result = x.empty() ? y : fromWord(std::gcd(toWord(x), toWord(y)));
+        for (auto remaining = twos; remaining > 0;)
+        {
+            const auto shift = std::min(remaining, 29ULL);
+            multiplySmall(result, Limb{ 1 } << shift);
+            remaining -= shift;
+        }
+        return result;
+    }
+
+    Limbs gcdLehmer(const Limbs& a, const Limbs& b)
+    {
+        Limbs x = a;
+        Limbs y = b;
+        if (compareMagnitude(x, y) < 0)
+            std::swap(x, y);
+        while (y.size() > WORD_LIMBS)
+            lehmerStep(x, y);
+        return finishWord(x, y);
+    }
+
+    BigDecimal gcd(const BigDecimal& a, const BigDecimal& b)
+    {
+        // Both numbers are integer multiples of 10^e, where e is the smaller exponent.
+        auto x = a;
+        auto y = b;
+        const auto exponent = std::min(x.exponent, y.exponent);
+        rescale(x, exponent);
+        rescale(y, exponent);
+
+        BigDecimal result{ .mantissa = gcdMagnitude(x.mantissa, y.mantissa), .exponent = exponent };
+        stripTrailingZeros(result);
+        return result;
+    }
+} // namespace steppable::__internals::bignum
@@ -0,0 +1,484 @@
+/**************************************************************************************************
+ * Copyright (c) 2023-2025 NWSOFT                                                                 *
+ *                                                                                                *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy                   *
+ * of this software and associated documentation files (the "Software"), to deal                  *
+ * in the Software without restriction, including without limitation the rights                   *
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell                      *
+ * copies of the Software, and to permit persons to whom the Software is                          *
+ * furnished to do so, subject to the following conditions:                                       *
+ *                                                                                                *
+ * The above copyright notice and this permission notice shall be included in all                 *
+ * copies or substantial portions of the Software.                                                *
+ *                                                                                                *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR                     *
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,                       *
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE                    *
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER                         *
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,                  *
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE                  *
+ * SOFTWARE.                                                                                      *
+ **************************************************************************************************/
+
+/**
+ * @file bignumMultiply.cpp
+ * @brief This file contains the multiplication engines of the limb-based backend.
+ *
+ * @author Andy Zhang
+ * @date 16th October 2026
+ */
+
+#include "bignum.hpp"
+
+#include "output.hpp"
+
+#include <algorithm>
+#include <array>
+#include <mutex>
+#include <random>
+#include <string>
+#include <utility>
+
+using namespace std::literals;
+
+namespace steppable::__internals::bignum
+{
+    namespace
+    {
+        /**
+         * @brief A magnitude with a sign, used for the intermediate values of Toom-3.
+         */
+        struct SignedLimbs
+        {
+            Limbs magnitude; ///< The absolute value.
+            bool negative = false; ///< Whether the value is negative.
+        };
+
+        SignedLimbs signedAdd(const SignedLimbs& a, const SignedLimbs& b)
+        {
+            if (a.negative == b.negative)
+                return { addMagnitude(a.magnitude, b.magnitude), a.negative };
+            if (compareMagnitude(a.magnitude, b.magnitude) >= 0)
+            {
+                auto difference = subtractMagnitude(a.magnitude, b.magnitude);
+                const bool negative = a.negative and not difference.empty();
+                return { std::move(difference), negative };
+            }
+            return { subtractMagnitude(b.magnitude, a.magnitude), b.negative };
+        }
+
+        SignedLimbs signedSubtract(const SignedLimbs& a, const SignedLimbs& b)
+        {
+            return signedAdd(a, { b.magnitude, not b.negative and not b.magnitude.empty() });
+        }
+
+        SignedLimbs signedMultiply(const SignedLimbs& a, const SignedLimbs& b)
+        {
+            auto product = multiplyMagnitude(a.magnitude, b.magnitude);
+            const bool negative = a.negative != b.negative and not product.empty();
+            return { std::move(product), negative };
+        }
+
+        void signedDivideExact(SignedLimbs& a, const Limb divisor)
+        {
+            divideSmall(a.magnitude, divisor);
+            a.negative = a.negative and not a.magnitude.empty();
+        }
+
+        /**
+         * @brief Copies part of a magnitude into a new one.
+         *
+         * @param a The magnitude to copy from.
+         * @param start The index of the first limb.
+         * @param length The maximum number of limbs to copy.
+         * @return The copied limbs, with leading zeros removed.
+         */
+        Limbs slice(const Limbs& a, const size_t start, const size_t length)
+        {
+            if (start >= a.size())
+                return {};
+            const auto end = std::min(a.size(), start + length);
+            Limbs result(a.begin() + static_cast<long>(start), a.begin() + static_cast<long>(end));
+            trim(result);
+            return result;
+        }
+
+        /**
+         * @brief Adds a magnitude into another one, shifted left by a number of limbs.
+         *
+         * @param a The magnitude to add to.
+         * @param b The magnitude to add.
+         * @param offset The number of limbs to shift b by.
+         */
+        void addShifted(Limbs& a, const Limbs& b, const size_t offset)
+        {
+            if (b.empty())
+                return;
+            if (a.size() < offset + b.size())
+                a.resize(offset + b.size(), 0);
+
+            Limb carry = 0;
+            size_t i = 0;
+            for (; i < b.size(); i++)
+            {
+                Limb sum = a[offset + i] + b[i] + carry;
+                carry = sum >= LIMB_BASE ? 1 : 0;
+                a[offset + i] = carry != 0 ? sum - LIMB_BASE : sum;
+            }
+            for (size_t k = offset + i; carry != 0; k++)
+            {
+                if (k == a.size())
+                    a.push_back(0);
+                const Limb sum = a[k] + carry;
+                carry = sum >= LIMB_BASE ? 1 : 0;
+                a[k] = carry != 0 ? sum - LIMB_BASE : sum;
+            }
+        }
+
+        /**
+         * @struct NTTPrime
+         * @brief A prime of the form c * 2^k + 1, which has 2^k-th roots of unity.
+         */
+        struct NTTPrime
+        {
+            std::uint32_t modulus; ///< The prime itself.
+            std::uint32_t generator; ///< A primitive root modulo the prime.
+        };
+
+        /// @brief The three primes used by the transform. Their product exceeds 2^23 * (10^9)^2.
+        constexpr std::array<NTTPrime, 3> NTT_PRIMES = { { { 998'244'353, 3 }, { 167'772'161, 3 }, { 469'762'049, 3 } } };
+
+        /// @brief The longest transform supported by all three primes.
+        constexpr size_t NTT_MAX_LENGTH = size_t{ 1 } << 23;
+
+        std::uint32_t powMod(std::uint64_t base, std::uint64_t exponent, const std::uint32_t modulus)
+        {
+            std::uint64_t result = 1;
+            base %= modulus;
+            while (exponent != 0)
+            {
+                if ((exponent & 1) != 0)
+                    result = result * base % modulus;
+                base = base * base % modulus;
+                exponent >>= 1;
+            }
+            return static_cast<std::uint32_t>(result);
+        }
+
+        /**
+         * @brief Transforms a sequence in place with the iterative Cooley-Tukey algorithm.
+         *
+         * @param values The sequence, whose length must be a power of two.
+         * @param prime The prime to work modulo.
+         * @param inverse Whether to perform the inverse transform.
+         */
+        void transform(std::vector<std::uint32_t>& values, const NTTPrime& prime, const bool inverse)
+        {
+            const size_t n = values.size();
+            const std::uint32_t modulus = prime.modulus;
+            for (size_t i = 1, j = 0; i < n; i++)
+            {
+                size_t bit = n >> 1;
+                for (; (j & bit) != 0; bit >>= 1)
+                    j ^= bit;
+                j ^= bit;
+                if (i < j)
+                    std::swap(values[i], values[j]);
+            }
+
+            std::vector<std::uint32_t> twiddles(n / 2);
+            for (size_t length = 2; length <= n; length <<= 1)
+            {
+                std::uint32_t step = powMod(prime.generator, (modulus - 1) / length, modulus);
+                if (inverse)
+                    step = powMod(step, modulus - 2, modulus);
+                const size_t half = length / 2;
+                twiddles[0] = 1;
+                for (size_t k = 1; k < half; k++)
+                    twiddles[k] = static_cast<std::uint32_t>(static_cast<std::uint64_t>(twiddles[k - 1]) * step % modulus);
+
+                for (size_t start = 0; start < n; start += length)
+                    for (size_t k = 0; k < half; k++)
+                    {
+                        const std::uint32_t u = values[start + k];
+                        const auto v = static_cast<std::uint32_t>(
+                            static_cast<std::uint64_t>(values[start + k + half]) * twiddles[k] % modulus);
+                        values[start + k] = u + v >= modulus ? u + v - modulus : u + v;
+                        values[start + k + half] = u >= v ? u - v : u + modulus - v;
+                    }
+            }
+
+            if (inverse)
+            {
+                const std::uint64_t nInverse = powMod(n, modulus - 2, modulus);
+                for (auto& value : values)
+                    value = static_cast<std::uint32_t>(value * nInverse % modulus);
+            }
+        }
+
+        /**
+         * @brief Computes the cyclic convolution of two magnitudes modulo a prime.
+         *
+         * @param a The first magnitude.
+         * @param b The second magnitude.
+         * @param length The length of the transform.
+         * @param prime The prime to work modulo.
+         * @return The convolution, reduced modulo the prime.
+         */
+        std::vector<std::uint32_t> convolve(const Limbs& a, const Limbs& b, const size_t length, const NTTPrime& prime)
+        {
+            std::vector<std::uint32_t> fa(length, 0);
+            std::vector<std::uint32_t> fb(length, 0);
+            for (size_t i = 0; i < a.size(); i++)
+                fa[i] = a[i] % prime.modulus;
+            for (size_t i = 0; i < b.size(); i++)
+                fb[i] = b[i] % prime.modulus;
+
+            transform(fa, prime, false);
+            transform(fb, prime, false);
+            for (size_t i = 0; i < length; i++)
+                fa[i] = static_cast<std::uint32_t>(static_cast<std::uint64_t>(fa[i]) * fb[i] % prime.modulus);
+            transform(fa, prime, true);
+            return fa;
+        }
+
+        /**
+         * @brief Reduces a magnitude modulo a 32-bit number.
+         *
+         * @param a The magnitude.
+         * @param modulus The modulus.
+         * @return The remainder.
+         */
+        std::uint64_t residue(const Limbs& a, const std::uint64_t modulus)
+        {
+            std::uint64_t result = 0;
+            for (size_t i = a.size(); i-- > 0;)
+                result = (result * LIMB_BASE + a[i]) % modulus;
+            return result;
+        }
+
+        /**
+         * @brief Picks a random prime between 2^31 and 2^32, for verifying products.
+         * @return The prime.
+         */
+        std::uint64_t randomCheckPrime()
+        {
+            static std::mutex mutex;
+            static std::mt19937_64 engine{ std::random_device{}() };
+            const std::lock_guard lock(mutex);
+            while (true)
+            {
+                const std::uint64_t candidate = (engine() % (std::uint64_t{ 1 } << 31)) | (std::uint64_t{ 1 } << 31) | 1;
+                bool isPrime = true;
+                for (std::uint64_t divisor = 3; divisor * divisor <= candidate and isPrime; divisor += 2)
+                    isPrime = candidate % divisor != 0;
+                if (isPrime)
+                    return candidate;
+            }
+        }
+
+        /**
+         * @brief Multiplies operands of very different sizes, by cutting the longer one into pieces as long as the
+         * shorter one.
+         *
+         * @param longer The longer operand.
+         * @param shorter The shorter operand.
+         * @return The product of the operands.
+         */
+        Limbs multiplyUnbalanced(const Limbs& longer, const Limbs& shorter)
+        {
+            Limbs result(longer.size() + shorter.size(), 0);
+            for (size_t start = 0; start < longer.size(); start += shorter.size())
+                addShifted(result, multiplyMagnitude(slice(longer, start, shorter.size()), shorter), start);
+            trim(result);
+            return result;
+        }
+    } // namespace
+
+    MultiplyThresholds& multiplyThresholds()
+    {
+        static MultiplyThresholds thresholds;
+        return thresholds;
+    }
+
+    Limbs multiplyMagnitude(const Limbs& a, const Limbs& b)
+    {
+        if (a.empty() or b.empty())
+            return {};
+
+        const auto& thresholds = multiplyThresholds();
+        const Limbs& longer = a.size() >= b.size() ? a : b;
+        const Limbs& shorter = a.size() >= b.size() ? b : a;
+        if (shorter.size() < thresholds.karatsuba)
+            return multiplySchoolbook(longer, shorter);
+        if (shorter.size() >= thresholds.ntt and longer.size() + shorter.size() <= NTT_MAX_LENGTH)
+            return multiplyNTT(longer, shorter);
+        if (longer.size() >= 2 * shorter.size())
+            return multiplyUnbalanced(longer, shorter);
+        if (shorter.size() < thresholds.toom3)
+            return multiplyKaratsuba(longer, shorter);
+        return multiplyToom3(longer, shorter);
+    }
+
+    Limbs multiplySchoolbook(const Limbs& a, const Limbs& b)
+    {
+        if (a.empty() or b.empty())
+            return {};
+
+        Limbs result(a.size() + b.size(), 0);
+        for (size_t i = 0; i < a.size(); i++)
+        {
+            std::uint64_t carry = 0;
+            const std::uint64_t aLimb = a[i];
+            if (aLimb == 0)
+                continue;
+            for (size_t j = 0; j < b.size(); j++)
+            {
+                const std::uint64_t current = result[i + j] + aLimb * b[j] + carry;
+                result[i + j] = static_cast<Limb>(current % LIMB_BASE);
+                carry = current / LIMB_BASE;
+            }
+            for (size_t k = i + b.size(); carry != 0; k++)
+            {
+                const std::uint64_t current = result[k] + carry;
+                result[k] = static_cast<Limb>(current % LIMB_BASE);
+                carry = current / LIMB_BASE;
+            }
+        }
+        trim(result);
+        return result;
+    }
+
+    Limbs multiplyKaratsuba(const Limbs& a, const Limbs& b)
+    {
+        // a = a1 * B^half + a0, b = b1 * B^half + b0
+        // a * b = z2 * B^(2*half) + z1 * B^half + z0, where
+        // z2 = a1 * b1, z0 = a0 * b0, z1 = (a0 + a1)(b0 + b1) - z2 - z0
+        const size_t half = (std::max(a.size(), b.size()) + 1) / 2;
+        const auto a0 = slice(a, 0, half);
+        const auto a1 = slice(a, half, a.size());
+        const auto b0 = slice(b, 0, half);
+        const auto b1 = slice(b, half, b.size());
+
+        const auto z0 = multiplyMagnitude(a0, b0);
+        const auto z2 = multiplyMagnitude(a1, b1);
+        auto z1 = multiplyMagnitude(addMagnitude(a0, a1), addMagnitude(b0, b1));
+        z1 = subtractMagnitude(subtractMagnitude(z1, z0), z2);
+
+        Limbs result(a.size() + b.size(), 0);
+        addShifted(result, z0, 0);
+        addShifted(result, z1, half);
+        addShifted(result, z2, 2 * half);
+        trim(result);
+        return result;
+    }
+
+    Limbs multiplyToom3(const Limbs& a, const Limbs& b)
+    {
+        // Split both operands into three parts and treat them as polynomials in x = B^third:
+        // a(x) = a2 * x^2 + a1 * x + a0. Evaluate at 0, 1, -1, -2 and infinity, multiply pointwise and interpolate.
+        const size_t third = (std::max(a.size(), b.size()) + 2) / 3;
+        const SignedLimbs a0{ slice(a, 0, third) }, a1{ slice(a, third, third) }, a2{ slice(a, 2 * third, third) };
+        const SignedLimbs b0{ slice(b, 0, third) }, b1{ slice(b, third, third) }, b2{ slice(b, 2 * third, third) };
+
+        const auto evaluate = [](const SignedLimbs& p0, const SignedLimbs& p1, const SignedLimbs& p2) {
+            const auto p02 = signedAdd(p0, p2);
+            const auto atOne = signedAdd(p02, p1);
+            const auto atMinusOne = signedSubtract(p02, p1);
+            // p(-2) = 2 * (p(-1) + p2) - p0
+            auto atMinusTwo = signedAdd(atMinusOne, p2);
+            multiplySmall(atMinusTwo.magnitude, 2);
+            atMinusTwo = signedSubtract(atMinusTwo, p0);
+            return std::array{ atOne, atMinusOne, atMinusTwo };
+        };
+        const auto [aOne, aMinusOne, aMinusTwo] = evaluate(a0, a1, a2);
+        const auto [bOne, bMinusOne, bMinusTwo] = evaluate(b0, b1, b2);
+
+        const auto r0 = signedMultiply(a0, b0);
+        const auto rOne = signedMultiply(aOne, bOne);
+        const auto rMinusOne = signedMultiply(aMinusOne, bMinusOne);
+        const auto rMinusTwo = signedMultiply(aMinusTwo, bMinusTwo);
+        const auto rInfinity = signedMultiply(a2, b2);
+
+        // Interpolation sequence by Bodrato.
+        auto r3 = signedSubtract(rMinusTwo, rOne);
+        signedDivideExact(r3, 3);
+        auto r1 = signedSubtract(rOne, rMinusOne);
+        signedDivideExact(r1, 2);
+        auto r2 = signedSubtract(rMinusOne, r0);
+        r3 = signedSubtract(r2, r3);
+        signedDivideExact(r3, 2);
+        auto twoInfinity = rInfinity;
+        multiplySmall(twoInfinity.magnitude, 2);
+        r3 = signedAdd(r3, twoInfinity);
+        r2 = signedSubtract(signedAdd(r2, r1), rInfinity);
+        r1 = signedSubtract(r1, r3);
+
+        Limbs result(a.size() + b.size() + 1, 0);
+        addShifted(result, r0.magnitude, 0);
+        addShifted(result, r1.magnitude, third);
+        addShifted(result, r2.magnitude, 2 * third);
+        addShifted(result, r3.magnitude, 3 * third);
+        addShifted(result, rInfinity.magnitude, 4 * third);
+        trim(result);
+        return result;
+    }
+
+    Limbs multiplyNTT(const Limbs& a, const Limbs& b)
+    {
+        if (a.empty() or b.empty())
+            return {};
+
+        const size_t productLength = a.size() + b.size() - 1;
+        size_t length = 1;
+        while (length < productLength)
+            length <<= 1;
+
+        const auto& [p1, p2, p3] = NTT_PRIMES;
+        const auto r1 = convolve(a, b, length, p1);
+        const auto r2 = convolve(a, b, length, p2);
+        const auto r3 = convolve(a, b, length, p3);
+
+        // Garner's algorithm: x = c1 + p1 * (c2 + p2 * c3), with c1 < p1, c2 < p2 and c3 < p3.
+        const std::uint64_t m1 = p1.modulus;
+        const std::uint64_t m2 = p2.modulus;
+        const std::uint64_t m3 = p3.modulus;
+        const std::uint64_t m1InverseMod2 = powMod(m1, m2 - 2, p2.modulus);
+        const std::uint64_t m1m2InverseMod3 = powMod(m1 * m2 % m3, m3 - 2, p3.modulus);
+
+        Limbs result(a.size() + b.size() + 1, 0);
+        std::uint64_t carry = 0;
+        std::uint64_t pendingHigh = 0;
+        for (size_t k = 0; k < productLength; k++)
+        {
+            const std::uint64_t c1 = r1[k];
+            const std::uint64_t c2 = (r2[k] + m2 - c1 % m2) % m2 * m1InverseMod2 % m2;
+            const std::uint64_t c3 = (r3[k] + m3 - (c1 + c2 * m1) % m3) % m3 * m1m2InverseMod3 % m3;
+            const std::uint64_t t = c2 + m2 * c3;
+
+            // x = c1 + m1 * t is too large for 64 bits, so add it in two limbs.
+            const std::uint64_t current = carry + c1 + m1 * (t % LIMB_BASE) + pendingHigh;
+            result[k] = static_cast<Limb>(current % LIMB_BASE);
+            carry = current / LIMB_BASE;
+            pendingHigh = m1 * (t / LIMB_BASE);
+        }
+        carry += pendingHigh;
+        for (size_t k = productLength; carry != 0; k++)
+        {
+            result[k] = static_cast<Limb>(carry % LIMB_BASE);
+            carry /= LIMB_BASE;
+        }
+        trim(result);
+
+        if (multiplyThresholds().selfCheck)
+        {
+            const auto prime = randomCheckPrime();
+            if (residue(a, prime) * residue(b, prime) % prime != residue(result, prime))
+            {
+                output::error("bignum::multiplyNTT"s, "Self-check failed, recomputing the product with Toom-3."s);
+                return multiplyToom3(a, b);
+            }
+        }
+        return result;
+    }
+} // namespace steppable::__internals::bignum
@@ -0,0 +1,526 @@
+/**************************************************************************************************
+ * Copyright (c) 2023-2025 NWSOFT                                                                 *
+ *                                                                                                *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy                   *
+ * of this software and associated documentation files (the "Software"), to deal                  *
+ * in the Software without restriction, including without limitation the rights                   *
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell                      *
+ * copies of the Software, and to permit persons to whom the Software is                          *
+ * furnished to do so, subject to the following conditions:                                       *
+ *                                                                                                *
+ * The above copyright notice and this permission notice shall be included in all                 *
+ * copies or substantial portions of the Software.                                                *
+ *                                                                                                *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR                     *
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,                       *
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE                    *
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER                         *
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,                  *
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE                  *
+ * SOFTWARE.                                                                                      *
+ **************************************************************************************************/
+
+
+/**
+ * @file bignumPrime.cpp
+ * @brief This file contains the primality test, integer factorization and multi-modular arithmetic of the limb-based
+ * backend.
+ *
+ * @author Andy Zhang
+ * @date 17th October 2026
+ */
+
+#include "bignum.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <mutex>
+#include <numeric>
+#include <utility>
+#include <vector>
+
+namespace steppable::__internals::bignum
+{
+    namespace
+    {
+        /// @brief Primes up to this bound are divided out before the probabilistic methods take over.
+        constexpr std::uint64_t TRIAL_DIVISION_BOUND = 1 << 15;
+
+        /// @brief The number of steps of Pollard's rho whose differences are multiplied together before taking a GCD.
+        constexpr std::uint64_t RHO_BATCH = 128;
+
+        /// @brief Miller-Rabin with these bases has no false positives below 3.3 * 10^24, which covers 64 bits.
+        constexpr std::uint64_t WITNESSES[] = { 2, 3, 5, 7, 11, 13, 17, 19, 23, 29, 31, 37, 41 };
+
+        /**
+         * @brief Gets the primes used for trial division.
+         * @return The primes up to TRIAL_DIVISION_BOUND.
+         */
+        const std::vector<std::uint64_t>& smallPrimes()
+        {
+            static const auto primes = primesUpTo(TRIAL_DIVISION_BOUND);
+            return primes;
+        }
+
+        /**
+         * @brief Converts a magnitude to a native integer, if it fits in 64 bits.
+         *
+         * @param a The magnitude.
+         * @param out The converted value.
+         * @return True if the magnitude fits, false otherwise.
+         */
+        bool toWord(const Limbs& a, std::uint64_t& out)
+        {
+            SmallDecimal small;
+            if (not narrow({ .mantissa = a }, small))
+                return false;
+            out = small.mantissa;
+            return true;
+        }
+
+        /**
+         * @brief Calculates (a + b) mod m without overflow.
+         *
+         * @param a The first addend, less than m.
+         * @param b The second addend, less than m.
+         * @param m The modulus.
+         * @return (a + b) mod m.
+         */
+        std::uint64_t addModulo(const std::uint64_t a, const std::uint64_t b, const std::uint64_t m)
+        {
+            return a >= m - b ? a - (m - b) : a + b;
+        }
+
+        /**
+         * @brief Calculates (a * b) mod m without overflow.
+         *
+         * @param a The first factor, less than m.
+         * @param b The second factor, less than m.
+         * @param m The modulus.
+         * @return (a * b) mod m.
+         */
+        std::uint64_t multiplyModulo(std::uint64_t a, std::uint64_t b, const std::uint64_t m)
+        {
+#ifdef __SIZEOF_INT128__
+            return static_cast<std::uint64_t>((static_cast<unsigned __int128>(a) * b) % m);
+#else
+            // Without 128-bit integers, multiply by doubling.
+            std::uint64_t result = 0;
+            for (; b != 0; b /= 2)
+            {
+                if (b % 2 == 1)
+                    result = addModulo(result, a, m);
+                a = addModulo(a, a, m);
+            }
+            return result;
+#endif
+        }
+
+        /**
+         * @brief Calculates (base ^ exponent) mod m by repeated squaring.
+         *
+         * @param base The base, less than m.
+         * @param exponent The exponent.
+         * @param m The modulus.
+         * @return (base ^ exponent) mod m.
+         */
+        std::uint64_t powerModulo(std::uint64_t base, std::uint64_t exponent, const std::uint64_t m)
+        {
+            std::uint64_t result = 1;
+            for (; exponent != 0; exponent /= 2)
+            {
+                if (exponent % 2 == 1)
+                    result = multiplyModulo(result, base, m);
+                base = multiplyModulo(base, base, m);
+            }
+            return result;
+        }
+
+        /**
+         * @brief Checks whether a number is prime with Miller-Rabin.
+         *
+         * @param n The number, odd and greater than every witness.
+         * @return True if n is prime, false otherwise.
+         */
+        bool millerRabin(const std::uint64_t n)
+        {
+            auto d = n - 1;
+            int s = 0;
+            for (; d % 2 == 0; d /= 2)
+                s++;
+
+            for (const auto witness : WITNESSES)
+            {
+                auto x = powerModulo(witness, d, n);
+                bool composite = x != 1 and x != n - 1;
+                for (int i = 1; i < s and composite; i++)
+                {
+                    x = multiplyModulo(x, x, n);
+                    composite = x != n - 1;
+                }
+                if (composite)
+                    return false;
+            }
+            return true;
+        }
+
+        /**
+         * @brief Finds a divisor of a composite number with Brent's variant of Pollard's rho.
+         *
+         * @param n The number, odd and composite.
+         * @return A divisor d with 1 < d < n.
+         */
+        std::uint64_t pollardBrent(const std::uint64_t n)
+        {
+            for (std::uint64_t c = 1;; c++)
+            {
+                const auto step = [c, n](const std::uint64_t value) {
+                    return addModulo(multiplyModulo(value, value, n), c, n);
+                };
+                std::uint64_t x = 2;
+                std::uint64_t y = 2;
+                std::uint64_t saved = 2;
+                std::uint64_t product = 1;
+                std::uint64_t divisor = 1;
+                for (std::uint64_t length = 1; divisor == 1; length *= 2)
+                {
+                    x = y;
+                    for (std::uint64_t i = 0; i < length; i++)
+                        y = step(y);
+                    for (std::uint64_t k = 0; k < length and divisor == 1; k += RHO_BATCH)
+                    {
+                        saved = y;
+                        for (std::uint64_t i = 0; i < std::min(RHO_BATCH, length - k); i++)
+                        {
+                            y = step(y);
+                            product = multiplyModulo(product, x > y ? x - y : y - x, n);
+                        }
+                        divisor = std::gcd(product, n);
+                    }
+                }
+
+                // A batch can overshoot to n, so its steps are retraced one at a time.
+                if (divisor == n)
+                {
+                    do
+                    {
+                        saved = step(saved);
+                        divisor = std::gcd(x > saved ? x - saved : saved - x, n);
+                    } while (divisor == 1);
+                }
+                if (divisor != n)
+                    return divisor;
+            }
+        }
+
+        /**
+         * @brief Calculates a mod m.
+         *
+         * @param a The magnitude.
+         * @param m The modulus, must not be zero.
+         * @return a mod m.
+         */
+        Limbs remainderOf(const Limbs& a, const Limbs& m)
+        {
+            if (compareMagnitude(a, m) < 0)
+                return a;
+            return divideMagnitude(a, m).remainder;
+        }
+
+        /**
+         * @brief Calculates (a * b) mod m.
+         *
+         * @param a The first factor, less than m.
+         * @param b The second factor, less than m.
+         * @param m The modulus.
+         * @return (a * b) mod m.
+         */
+        Limbs multiplyModulo(const Limbs& a, const Limbs& b, const Limbs& m)
+        {
+            return remainderOf(multiplyMagnitude(a, b), m);
+        }
+
+        /**
+         * @brief Calculates (base ^ exponent) mod m by repeated squaring.
+         *
+         * @param base The base, less than m.
+         * @param exponent The exponent.
+         * @param m The modulus.
+         * @return (base ^ exponent) mod m.
+         */
+        Limbs powerModulo(Limbs base, Limbs exponent, const Limbs& m)
+        {
+            Limbs result{ 1 };
+            while (not exponent.empty())
+            {
+                // The limb base is even, so the parity of the exponent is that of its lowest limb.
+                if (exponent.front() % 2 == 1)
+                    result = multiplyModulo(result, base, m);
+                divideSmall(exponent, 2);
+                if (not exponent.empty())
+                    base = multiplyModulo(base, base, m);
+            }
+            return result;
+        }
+
+        /**
+         * @brief Checks whether a number is prime with Miller-Rabin.
+         *
+         * @param n The number, odd and greater than 64 bits.
+         * @return True if n is a probable prime, false if it is composite.
+         */
+        bool millerRabin(const Limbs& n)
+        {
+            const auto nMinusOne = subtractMagnitude(n, { 1 });
+            auto d = nMinusOne;
+            int s = 0;
+            for (; d.front() % 2 == 0; s++)
+                divideSmall(d, 2);
+
+            for (const auto witness : WITNESSES)
+            {
+                auto x = powerModulo(fromInteger(witness).mantissa, d, n);
+                bool composite = x != Limbs{ 1 } and x != nMinusOne;
+                for (int i = 1; i < s and composite; i++)
+                {
+                    x = multiplyModulo(x, x, n);
+                    composite = x != nMinusOne;
+                }
+                if (composite)
+                    return false;
+            }
+            return true;
+        }
+
+        /**
+         * @brief Calculates the absolute difference of two magnitudes.
+         *
+         * @param a The first magnitude.
+         * @param b The second magnitude.
+         * @return |a - b|.
+         */
+        Limbs difference(const Limbs& a, const Limbs& b)
+        {
+            return compareMagnitude(a, b) >= 0 ? subtractMagnitude(a, b) : subtractMagnitude(b, a);
+        }
+
+        /**
+         * @brief Finds a divisor of a composite number with Brent's variant of Pollard's rho.
+         *
+         * @param n The number, odd, composite and greater than 64 bits.
+         * @return A divisor d with 1 < d < n.
+         */
+        Limbs pollardBrent(const Limbs& n)
+        {
+            for (Limb c = 1;; c++)
+            {
+                const auto step = [c, &n](const Limbs& value) {
+                    return remainderOf(addMagnitude(multiplyMagnitude(value, value), { c }), n);
+                };
+                Limbs x{ 2 };
+                Limbs y{ 2 };
+                Limbs saved{ 2 };
+                Limbs product{ 1 };
+                Limbs divisor{ 1 };
+                for (std::uint64_t length = 1; divisor == Limbs{ 1 }; length *= 2)
+                {
+                    x = y;
+                    for (std::uint64_t i = 0; i < length; i++)
+                        y = step(y);
+                    for (std::uint64_t k = 0; k < length and divisor == Limbs{ 1 }; k += RHO_BATCH)
+                    {
+                        saved = y;
+                        for (std::uint64_t i = 0; i < std::min(RHO_BATCH, length - k); i++)
+                        {
+                            y = step(y);
+                            product = multiplyModulo(product, difference(x, y), n);
+                        }
+                        divisor = gcdMagnitude(n, product);
+                    }
+                }
+
+                if (divisor == n)
+                {
+                    do
+                    {
+                        saved = step(saved);
+                        divisor = gcdMagnitude(n, difference(x, saved));
+                    } while (divisor == Limbs{ 1 });
+                }
+                if (divisor != n)
+                    return divisor;
+            }
+        }
+
+        /**
+         * @brief Checks whether a number without prime factors up to TRIAL_DIVISION_BOUND is prime.
+         *
+         * @param n The number.
+         * @return True if n is a probable prime, false if it is composite.
+         */
+        bool isPrimeCofactor(const Limbs& n)
+        {
+            if (std::uint64_t word = 0; toWord(n, word))
+                return word < TRIAL_DIVISION_BOUND * TRIAL_DIVISION_BOUND or millerRabin(word);
+            return millerRabin(n);
+        }
+
+        /**
+         * @brief Splits a number without prime factors up to TRIAL_DIVISION_BOUND into primes.
+         *
+         * @param n The number.
+         * @param primes The list to add the prime factors of n to.
+         */
+        // NOLINTNEXTLINE(*-no-recursion)
+        void splitCofactor(const Limbs& n, std::vector<Limbs>& primes)
+        {
+            if (isPrimeCofactor(n))
+            {
+                primes.push_back(n);
+                return;
+            }
+
+            Limbs divisor;
+            if (std::uint64_t word = 0; toWord(n, word))
+                divisor = fromInteger(pollardBrent(word)).mantissa;
+            else
+                divisor = pollardBrent(n);
+            splitCofactor(divisor, primes);
+            splitCofactor(divideMagnitude(n, divisor).quotient, primes);
+        }
+
+        /**
+         * @brief Divides out the primes up to TRIAL_DIVISION_BOUND.
+         *
+         * @param n The number, which is left with its other prime factors.
+         * @param primes The list to add the prime factors found to.
+         * @return True if what is left of n is 1 or a prime, false if it still has to be split.
+         */
+        bool trialDivide(Limbs& n, std::vector<Limbs>& primes)
+        {
+            for (const auto p : smallPrimes())
+            {
+                // Once p^2 exceeds what is left, it has no smaller factor and is therefore 1 or a prime.
+                if (std::uint64_t word = 0; toWord(n, word) and p * p > word)
+                    return true;
+                while (true)
+                {
+                    auto quotient = n;
+                    if (divideSmall(quotient, static_cast<Limb>(p)) != 0)
+                        break;
+                    n = std::move(quotient);
+                    primes.push_back({ static_cast<Limb>(p) });
+                }
+            }
+            return false;
+        }
+
+        /**
+         * @brief Gets the magnitude of an integer.
+         *
+         * @param n The integer.
+         * @return |n| as limbs.
+         */
+        Limbs integerMagnitude(const BigDecimal& n)
+        {
+            auto integer = n;
+            stripTrailingZeros(integer);
+            return shiftLeftDigits(integer.mantissa, integer.exponent);
+        }
+    } // namespace
+
+    bool isPrime(const BigDecimal& n)
+    {
+        auto integer = n;
+        stripTrailingZeros(integer);
+        if (n.negative or not integer.isInteger())
+            return false;
+
+        auto magnitude = integerMagnitude(integer);
+        if (compareMagnitude(magnitude, { 2 }) < 0)
+            return false;
+        std::vector<Limbs> primes;
+        if (trialDivide(magnitude, primes))
+            return primes.empty();
+        return primes.empty() and isPrimeCofactor(magnitude);
+    }
+
+    std::vector<PrimePower> factorize(const BigDecimal& n)
+    {
+        auto magnitude = integerMagnitude(n);
+        std::vector<Limbs> primes;
+        if (trialDivide(magnitude, primes))
+        {
+            if (compareMagnitude(magnitude, { 1 }) > 0)
+                primes.push_back(magnitude);
+        }
+        else if (compareMagnitude(magnitude, { 1 }) > 0)
+            splitCofactor(magnitude, primes);
+
+        std::ranges::sort(primes, [](const Limbs& a, const Limbs& b) { return compareMagnitude(a, b) < 0; });
+        std::vector<PrimePower> result;
+        for (auto& prime : primes)
+        {
+            if (not result.empty() and result.back().prime.mantissa == prime)
+                result.back().exponent++;
+            else
+                result.push_back({ .prime = { .mantissa = std::move(prime) }, .exponent = 1 });
+        }
+        return result;
+    }
+
+    std::vector<std::uint64_t> modularPrimes(const size_t count)
+    {
+        static std::mutex mutex;
+        static std::vector<std::uint64_t> primes;
+
+        const std::scoped_lock lock(mutex);
+        auto candidate = primes.empty() ? (1ULL << MODULAR_PRIME_BITS) - 1 : primes.back() - 2;
+        for (; primes.size() < count; candidate -= 2)
+            if (millerRabin(candidate))
+                primes.push_back(candidate);
+        return { primes.begin(), primes.begin() + static_cast<std::ptrdiff_t>(count) };
+    }
+
+    std::uint64_t remainderWord(const Limbs& a, const std::uint64_t m)
+    {
+        const auto base = LIMB_BASE % m;
+        std::uint64_t result = 0;
+        for (auto limb = a.rbegin(); limb != a.rend(); ++limb)
+            result = addModulo(multiplyModulo(result, base, m), *limb % m, m);
+        return result;
+    }
+
+    BigDecimal chineseRemainder(const std::vector<std::uint64_t>& residues, const std::vector<std::uint64_t>& primes)
+    {
+        if (primes.empty())
+            return {};
+
+        // x = d_0 + d_1 p_0 + d_2 p_0 p_1 + ..., where each digit d_i is less than p_i.
+        std::vector<std::uint64_t> digits(primes.size());
+        for (size_t i = 0; i < primes.size(); i++)
+        {
+            const auto p = primes[i];
+            std::uint64_t value = 0;
+            std::uint64_t radix = 1;
+            for (size_t j = 0; j < i; j++)
+            {
+                value = addModulo(value, multiplyModulo(digits[j] % p, radix, p), p);
+                radix = multiplyModulo(radix, primes[j] % p, p);
+            }
+            const auto residue = residues[i] % p;
+            const auto difference = residue >= value ? residue - value : residue + (p - value);
+            digits[i] = multiplyModulo(difference, powerModulo(radix, p - 2, p), p);
+        }
+
+        auto result = fromInteger(digits.back());
+        for (size_t i = primes.size() - 1; i-- > 0;)
+            result = add(multiply(result, fromInteger(primes[i])), fromInteger(digits[i]));
+
+        // The digits give 0 <= x < p_0 p_1 ..., and the upper half stands for the negative integers.
+        const auto product = productTree(primes);
+        if (compare(multiply(result, fromInteger(2)), product) > 0)
+            result = subtract(result, product);
+        return result;
+    }
+} // namespace steppable::__internals::bignum
@@ -0,0 +1,266 @@
+/**************************************************************************************************
+ * Copyright (c) 2023-2025 NWSOFT                                                                 *
+ *                                                                                                *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy                   *
+ * of this software and associated documentation files (the "Software"), to deal                  *
+ * in the Software without restriction, including without limitation the rights                   *
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell                      *
+ * copies of the Software, and to permit persons to whom the Software is                          *
+ * furnished to do so, subject to the following conditions:                                       *
+ *                                                                                                *
+ * The above copyright notice and this permission notice shall be included in all                 *
+ * copies or substantial portions of the Software.                                                *
+ *                                                                                                *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR                     *
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,                       *
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE                    *
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER                         *
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,                  *
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE                  *
+ * SOFTWARE.                                                                                      *
+ **************************************************************************************************/
+
+/**
+ * @file bignumRadix.cpp
+ * @brief This file contains the conversion of magnitudes to and from other bases, in the limb-based backend.
+ *
+ * @author Andy Zhang
+ * @date 17th October 2026
+ */
+
+#include "bignum.hpp"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cmath>
+#include <cstdint>
+#include <mutex>
+#include <span>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace steppable::__internals::bignum
+{
+    namespace
+    {
+        /// @brief The numerals of bases up to 36.
+        constexpr std::string_view NUMERALS = "0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZ";
+
+        /**
+         * @struct Chunk
+         * @brief The largest power of a base that fits in a limb. Conversions work on whole chunks of digits.
+         */
+        struct Chunk
+        {
+            unsigned base = 10; ///< The base.
+            long long digits = 0; ///< The number of digits in a chunk.
+            Limb value = 1; ///< base^digits.
+            int bits = 0; ///< log2(base) if the base is a power of two, otherwise 0.
+        };
+
+        Chunk chunkOf(const unsigned base)
+        {
+            Chunk chunk{ .base = base };
+            while (static_cast<std::uint64_t>(chunk.value) * base <= LIMB_BASE)
+            {
+                chunk.value *= base;
+                chunk.digits++;
+            }
+            if (std::has_single_bit(base))
+                chunk.bits = std::countr_zero(base);
+            return chunk;
+        }
+
+        /**
+         * @struct PowerCache
+         * @brief The powers chunk^(2^k) of a base, kept between conversions.
+         */
+        struct PowerCache
+        {
+            std::vector<Limbs> powers; ///< The powers calculated so far.
+            std::mutex mutex; ///< Guards the powers, as several threads may convert at once.
+        };
+
+        /**
+         * @brief Gets the powers chunk^(2^k) for k < count, calculating only the ones not cached yet.
+         *
+         * @param chunk The chunk of the base.
+         * @param count The number of powers needed.
+         * @return The powers.
+         */
+        std::vector<Limbs> chunkPowers(const Chunk& chunk, const size_t count)
+        {
+            static std::array<PowerCache, NUMERALS.size() + 1> caches;
+            auto& cache = caches[chunk.base];
+            const std::scoped_lock lock(cache.mutex);
+            if (cache.powers.empty())
+                cache.powers.push_back({ chunk.value });
+            while (cache.powers.size() < count)
+                cache.powers.push_back(multiplyMagnitude(cache.powers.back(), cache.powers.back()));
+            return { cache.powers.begin(), cache.powers.begin() + static_cast<std::ptrdiff_t>(count) };
+        }
+
+        /**
+         * @brief Splits a magnitude into exactly 2^k chunks.
+         * @details The magnitude is divided by chunk^(2^(k - 1)), and both halves are split recursively. Small pieces
+         * are split by dividing by the chunk one at a time.
+         *
+         * @param a The magnitude, less than chunk^(2^k).
+         * @param k The level in the power tree.
+         * @param powers The powers chunk^(2^i) for i < k.
+         * @param chunk The chunk of the base.
+         * @param out Where the chunks are written, least significant first.
+         */
+        // NOLINTNEXTLINE(*-no-recursion)
+        void toChunks(const Limbs& a, const size_t k, const std::vector<Limbs>& powers, const Chunk& chunk, Limb* out)
+        {
+            const size_t count = size_t{ 1 } << k;
+            if (a.empty())
+            {
+                std::fill_n(out, count, 0);
+                return;
+            }
+            if (count <= RADIX_CONVERSION_THRESHOLD)
+            {
+                auto remaining = a;
+                for (size_t i = 0; i < count; i++)
+                    out[i] = divideSmall(remaining, chunk.value);
+                return;
+            }
+
+            const auto [quotient, remainder] = divideMagnitude(a, powers[k - 1]);
+            toChunks(remainder, k - 1, powers, chunk, out);
+            toChunks(quotient, k - 1, powers, chunk, out + (count / 2));
+        }
+
+        /**
+         * @brief Joins chunks into a magnitude.
+         * @details The chunks are halved at chunk^(2^(k - 1)), and the upper half is multiplied by the power and added
+         * to the lower half. Small pieces are joined with Horner's scheme.
+         *
+         * @param chunks The chunks, least significant first. There are at most 2^k of them.
+         * @param k The level in the power tree.
+         * @param powers The powers chunk^(2^i) for i < k.
+         * @param chunk The chunk of the base.
+         * @return The magnitude.
+         */
+        // NOLINTNEXTLINE(*-no-recursion)
+        Limbs fromChunks(const std::span<const Limb> chunks,
+                         const size_t k,
+                         const std::vector<Limbs>& powers,
+                         const Chunk& chunk)
+        {
+            if (chunks.size() <= RADIX_CONVERSION_THRESHOLD)
+            {
+                Limbs result;
+                for (auto chunkValue = chunks.rbegin(); chunkValue != chunks.rend(); ++chunkValue)
+                    multiplySmall(result, chunk.value, *chunkValue);
+                return result;
+            }
+
+            const size_t half = size_t{ 1 } << (k - 1);
+            if (chunks.size() <= half)
+                return fromChunks(chunks, k - 1, powers, chunk);
+            const auto low = fromChunks(chunks.first(half), k - 1, powers, chunk);
+            const auto high = fromChunks(chunks.subspan(half), k - 1, powers, chunk);
+            return addMagnitude(multiplyMagnitude(high, powers[k - 1]), low);
+        }
+
+        /**
+         * @brief Finds the value of a numeral.
+         *
+         * @param numeral The numeral, a digit or a letter of either case.
+         * @return The value, or 36 if the character is not a numeral.
+         */
+        unsigned numeralValue(const char numeral)
+        {
+            if ('0' <= numeral and numeral <= '9')
+                return static_cast<unsigned>(numeral - '0');
+            if ('A' <= numeral and numeral <= 'Z')
+                return static_cast<unsigned>(numeral - 'A' + 10);
+            if ('a' <= numeral and numeral <= 'z')
+                return static_cast<unsigned>(numeral - 'a' + 10);
+            return NUMERALS.size();
+        }
+    } // namespace
+
+    std::string toBase(const Limbs& a, const unsigned base)
+    {
+        if (a.empty())
+            return "0";
+        if (base == 10)
+            return toString(BigDecimal{ .mantissa = a });
+
+        // chunk^(2^k) has to exceed a. Start from the largest k that surely does not, as a >= LIMB_BASE^(size - 1).
+        const auto chunk = chunkOf(base);
+        const double chunkLog = std::log(static_cast<double>(chunk.value));
+        const double lowerLog = static_cast<double>(a.size() - 1) * std::log(static_cast<double>(LIMB_BASE));
+        size_t k = 0;
+        while (static_cast<double>(size_t{ 1 } << (k + 1)) * chunkLog <= lowerLog)
+            k++;
+        auto powers = chunkPowers(chunk, k + 1);
+        while (compareMagnitude(powers[k], a) <= 0)
+            powers = chunkPowers(chunk, ++k + 1);
+
+        std::vector<Limb> chunks(size_t{ 1 } << k);
+        toChunks(a, k, powers, chunk, chunks.data());
+
+        // Each chunk becomes a fixed number of numerals. Powers of two take them from the bits directly.
+        std::string result(chunks.size() * static_cast<size_t>(chunk.digits), '0');
+        auto numeral = result.rbegin();
+        const Limb mask = base - 1;
+        for (Limb value : chunks)
+            for (long long digit = 0; digit < chunk.digits; digit++, ++numeral)
+            {
+                if (chunk.bits != 0)
+                {
+                    *numeral = NUMERALS[value & mask];
+                    value >>= chunk.bits;
+                }
+                else
+                {
+                    *numeral = NUMERALS[value % base];
+                    value /= base;
+                }
+            }
+        result.erase(0, result.find_first_not_of('0'));
+        return result.empty() ? "0" : result;
+    }
+
+    bool fromBase(const std::string_view digits, const unsigned base, Limbs& out)
+    {
+        if (digits.empty() or std::ranges::any_of(digits, [base](const char c) { return numeralValue(c) >= base; }))
+            return false;
+        if (base == 10)
+        {
+            BigDecimal number;
+            parse(digits, number);
+            out = std::move(number.mantissa);
+            return true;
+        }
+
+        // Group the numerals into chunks from the right. Powers of two place them in the bits directly.
+        const auto chunk = chunkOf(base);
+        const auto width = static_cast<size_t>(chunk.digits);
+        std::vector<Limb> chunks((digits.size() + width - 1) / width);
+        for (size_t i = 0; i < chunks.size(); i++)
+        {
+            const size_t end = digits.size() - (i * width);
+            const size_t begin = end >= width ? end - width : 0;
+            Limb value = 0;
+            for (size_t j = begin; j < end; j++)
+                value = chunk.bits != 0 ? (value << chunk.bits) | numeralValue(digits[j])
+                                        : (value * base) + numeralValue(digits[j]);
+            chunks[i] = value;
+        }
+
+        size_t k = 0;
+        while ((size_t{ 1 } << k) < chunks.size())
+            k++;
+        out = fromChunks(chunks, k, chunkPowers(chunk, k), chunk);
+        return true;
+    }
+} // namespace steppable::__internals::bignum
@@ -0,0 +1,185 @@
+/**************************************************************************************************
+ * Copyright (c) 2023-2025 NWSOFT                                                                 *
+ *                                                                                                *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy                   *
+ * of this software and associated documentation files (the "Software"), to deal                  *
+ * in the Software without restriction, including without limitation the rights                   *
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell                      *
+ * copies of the Software, and to permit persons to whom the Software is                          *
+ * furnished to do so, subject to the following conditions:                                       *
+ *                                                                                                *
+ * The above copyright notice and this permission notice shall be included in all                 *
+ * copies or substantial portions of the Software.                                                *
+ *                                                                                                *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR                     *
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,                       *
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE                    *
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER                         *
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,                  *
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE                  *
+ * SOFTWARE.                                                                                      *
+ **************************************************************************************************/
+
+/**
+ * @file bignumRoot.cpp
+ * @brief This file contains the square and n-th roots of the limb-based backend.
+ *
+ * @author Andy Zhang
+ * @date 16th October 2026
+ */
+
+#include "bignum.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <utility>
+#include <vector>
+
+namespace steppable::__internals::bignum
+{
+    namespace
+    {
+        /**
+         * @brief Raises a number to a power by repeated squaring, rounding every product off.
+         *
+         * @param base The base, 1 <= base < 10, so that the rounding keeps the relative precision.
+         * @param exponent The exponent.
+         * @param decimals The number of decimal places to keep.
+         * @return base^exponent, accurate to a few units in the last place for every squaring.
+         */
+        BigDecimal powerRounded(const BigDecimal& base, unsigned long long exponent, const long long decimals)
+        {
+            auto result = fromInteger(1);
+            for (auto square = base; exponent != 0; exponent /= 2)
+            {
+                if (exponent % 2 == 1)
+                    result = roundOff(multiply(result, square), decimals);
+                if (exponent > 1)
+                    square = roundOff(multiply(square, square), decimals);
+            }
+            return result;
+        }
+    } // namespace
+
+    Limbs squareRootMagnitude(const Limbs& a) { return squareRoot({ .mantissa = a }, 0).mantissa; }
+
+    BigDecimal squareRoot(const BigDecimal& x, const long long decimals)
+    {
+        if (x.isZero())
+            return { .exponent = -decimals };
+
+        // x = m * 100^j, where 1 <= m < 100, so that sqrt(x) = sqrt(m) * 10^j.
+        const long long integerDigits = countDigits(x.mantissa) + x.exponent;
+        const long long j = integerDigits > 0 ? (integerDigits - 1) / 2 : -((2 - integerDigits) / 2);
+        auto m = x;
+        m.exponent -= 2 * j;
+        const long long working = std::max(decimals + j, 0LL) + 4;
+
+        std::vector<long long> precisions;
+        for (long long precision = working; precision > 12; precision = (precision / 2) + 2)
+            precisions.push_back(precision);
+
+        // y = y + y (1 - m y^2) / 2 converges to 1 / sqrt(m).
+        auto y = fromInteger(std::llround(1e14 / std::sqrt(toDouble(m))));
+        y.exponent = -14;
+        const BigDecimal half{ .mantissa = { 5 }, .exponent = -1 };
+        for (auto precision = precisions.rbegin(); precision != precisions.rend(); ++precision)
+        {
+            const auto error = subtract(fromInteger(1), multiply(roundOff(m, *precision), multiply(y, y)));
+            y = roundOff(add(y, multiply(multiply(y, roundOff(error, *precision)), half)), *precision);
+        }
+
+        auto result = roundOff(multiply(m, y), working);
+        result.exponent += j;
+        result = roundOff(result, decimals);
+
+        // The estimate is within a unit or two of the last place, so step to floor(sqrt(x)) * 10^-decimals.
+        const BigDecimal unit{ .mantissa = { 1 }, .exponent = -decimals };
+        while (compare(multiply(result, result), x) > 0)
+            result = subtract(result, unit);
+        while (true)
+        {
+            auto next = add(result, unit);
+            if (compare(multiply(next, next), x) > 0)
+                break;
+            result = std::move(next);
+        }
+        if (result.isZero())
+            return { .exponent = -decimals };
+        rescale(result, -decimals);
+        return result;
+    }
+
+    BigDecimal nthRoot(const BigDecimal& x, const unsigned long long n, const long long decimals)
+    {
+        if (n == 2)
+            return squareRoot(x, decimals);
+        if (x.isZero())
+            return { .exponent = -decimals };
+        if (n == 1)
+            return divideTruncated(x, fromInteger(1), decimals);
+
+        // x = m * 10^(n j), where 1 <= m < 10^n, so that root(x) = root(m) * 10^j and 1 <= root(m) < 10.
+        const long long integerDigits = countDigits(x.mantissa) + x.exponent;
+        long long j = 0;
+        if (integerDigits > 0 and static_cast<unsigned long long>(integerDigits) > n)
+            j = static_cast<long long>(static_cast<unsigned long long>(integerDigits - 1) / n);
+        else if (integerDigits <= 0)
+            j = -static_cast<long long>((static_cast<unsigned long long>(-integerDigits) / n) + 1);
+        auto m = x;
+        m.exponent -= j * static_cast<long long>(n);
+
+        const auto index = fromInteger(n);
+        const long long guard = countDigits(index.mantissa);
+        const long long working = std::max(decimals + j, 0LL) + guard + 4;
+        std::vector<long long> precisions;
+        for (long long precision = working; precision > 12; precision = (precision / 2) + 2)
+            precisions.push_back(precision);
+
+        // m itself may not fit in a double, so the estimate is taken from log10(m).
+        const long long mDigits = countDigits(m.mantissa) + m.exponent - 1;
+        auto leading = m;
+        leading.exponent -= mDigits;
+        const double logM = std::log10(toDouble(leading)) + static_cast<double>(mDigits);
+        auto y = fromInteger(std::llround(std::pow(10.0, logM / static_cast<double>(n)) * 1e14));
+        y.exponent = -14;
+
+        // y = y + (m / y^(n - 1) - y) / n
+        for (auto precision = precisions.rbegin(); precision != precisions.rend(); ++precision)
+        {
+            const auto yPower = powerRounded(y, n - 1, *precision + guard);
+            const auto quotient = divideTruncated(m, yPower, *precision);
+            y = roundOff(add(y, divideTruncated(subtract(quotient, y), index, *precision)), *precision);
+        }
+
+        // The estimate is accurate to a few units in its last place, so its truncation is the result unless it lies
+        // close to a multiple of 10^-decimals.
+        auto estimate = std::move(y);
+        estimate.exponent += j;
+        auto result = divideTruncated(estimate, fromInteger(1), decimals);
+        const BigDecimal unit{ .mantissa = { 1 }, .exponent = -decimals };
+        const BigDecimal margin{ .mantissa = { 100 }, .exponent = estimate.exponent };
+        const auto remainder = subtract(estimate, result);
+        if (compare(margin, unit) < 0 and compare(remainder, margin) > 0 and compare(add(remainder, margin), unit) < 0)
+        {
+            if (result.isZero())
+                return { .exponent = -decimals };
+            return result;
+        }
+
+        // Otherwise, as with square roots, step to floor(root(x)) * 10^-decimals.
+        while (not result.isZero() and compare(power(result, n), x) > 0)
+            result = subtract(result, unit);
+        while (true)
+        {
+            auto next = add(result, unit);
+            if (compare(power(next, n), x) > 0)
+                break;
+            result = std::move(next);
+        }
+        if (result.isZero())
+            return { .exponent = -decimals };
+        rescale(result, -decimals);
+        return result;
+    }
+} // namespace steppable::__internals::bignum
@@ -0,0 +1,136 @@
+/**************************************************************************************************
+ * Copyright (c) 2023-2025 NWSOFT                                                                 *
+ *                                                                                                *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy                   *
+ * of this software and associated documentation files (the "Software"), to deal                  *
+ * in the Software without restriction, including without limitation the rights                   *
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell                      *
+ * copies of the Software, and to permit persons to whom the Software is                          *
+ * furnished to do so, subject to the following conditions:                                       *
+ *                                                                                                *
+ * The above copyright notice and this permission notice shall be included in all                 *
+ * copies or substantial portions of the Software.                                                *
+ *                                                                                                *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR                     *
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,                       *
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE                    *
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER                         *
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,                  *
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE                  *
+ * SOFTWARE.                                                                                      *
+ **************************************************************************************************/
+
+/**
+ * @file bignumSeries.cpp
+ * @brief This file contains the binary-splitting summation of hypergeometric series.
+ *
+ * @author Andy Zhang
+ * @date 16th October 2026
+ */
+
+#include "bignum.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace steppable::__internals::bignum
+{
+    namespace
+    {
+        /**
+         * @struct SplitTerms
+         * @brief The exact products and partial sum of a range of terms, where the sum equals T / (B * Q).
+         */
+        struct SplitTerms
+        {
+            BigDecimal P; ///< The product of p(j).
+            BigDecimal Q; ///< The product of q(j).
+            BigDecimal B; ///< The product of b(j).
+            BigDecimal T; ///< The numerator of the partial sum.
+        };
+
+        /**
+         * @brief Combines the terms in [from, to) of a series.
+         *
+         * @param series The series.
+         * @param from The first term.
+         * @param to One past the last term.
+         * @return The products and the partial sum.
+         */
+        // NOLINTNEXTLINE(*-no-recursion)
+        SplitTerms split(const HypergeometricSeries& series, const long long from, const long long to)
+        {
+            if (to - from == 1)
+            {
+                SplitTerms result{ .P = series.p(from), .Q = series.q(from), .B = fromInteger(1) };
+                if (series.b)
+                    result.B = series.b(from);
+                result.T = series.a ? multiply(series.a(from), result.P) : result.P;
+                return result;
+            }
+
+            const long long middle = from + ((to - from) / 2);
+            auto left = split(series, from, middle);
+            auto right = split(series, middle, to);
+
+            // T = B2 * Q2 * T1 + B1 * P1 * T2
+            SplitTerms result;
+            if (series.b)
+            {
+                result.T = add(multiply(multiply(right.B, right.Q), left.T),
+                               multiply(multiply(left.B, left.P), right.T));
+                result.B = multiply(left.B, right.B);
+            }
+            else
+            {
+                result.T = add(multiply(right.Q, left.T), multiply(left.P, right.T));
+                result.B = std::move(left.B);
+            }
+            result.P = multiply(left.P, right.P);
+            result.Q = multiply(left.Q, right.Q);
+            return result;
+        }
+    } // namespace
+
+    BigDecimal sumSeries(const HypergeometricSeries& series, const long long terms, const long long decimals)
+    {
+        if (terms <= 0)
+            return { .exponent = -decimals };
+        const auto result = split(series, 0, terms);
+        return divideTruncated(result.T, multiply(result.B, result.Q), decimals);
+    }
+
+    std::vector<DigitGroup> splitDigitGroups(const BigDecimal& x, const long long decimals)
+    {
+        auto magnitude = roundOff(x, decimals);
+        magnitude.negative = false;
+        auto digits = toString(magnitude);
+        const auto point = digits.find('.');
+        digits = point == std::string::npos ? "" : digits.substr(point + 1);
+        digits.resize(decimals, '0');
+
+        std::vector<DigitGroup> groups;
+        for (long long start = 0, end = 2; start < decimals; start = end, end *= 2)
+        {
+            const long long groupEnd = std::min(end, decimals);
+            DigitGroup group{ .end = groupEnd };
+            parse(std::string_view(digits).substr(start, groupEnd - start), group.numerator);
+            if (not group.numerator.isZero())
+                groups.push_back(std::move(group));
+        }
+        return groups;
+    }
+
+    long long taylorTerms(const DigitGroup& group, const long long decimals)
+    {
+        // The group is below 10^(length - end), and its n-th power over n! has to fall below 10^-decimals.
+        const auto logGroup = static_cast<double>(countDigits(group.numerator.mantissa) - group.end);
+        long long power = 1;
+        for (double logTerm = 0; logTerm > -static_cast<double>(decimals); power++)
+            logTerm += logGroup - std::log10(static_cast<double>(power));
+        return power;
+    }
+} // namespace steppable::__internals::bignum
@@ -0,0 +1,368 @@
+/**************************************************************************************************
+ * Copyright (c) 2023-2025 NWSOFT                                                                 *
+ *                                                                                                *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy                   *
+ * of this software and associated documentation files (the "Software"), to deal                  *
+ * in the Software without restriction, including without limitation the rights                   *
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell                      *
+ * copies of the Software, and to permit persons to whom the Software is                          *
+ * furnished to do so, subject to the following conditions:                                       *
+ *                                                                                                *
+ * The above copyright notice and this permission notice shall be included in all                 *
+ * copies or substantial portions of the Software.                                                *
+ *                                                                                                *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR                     *
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,                       *
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE                    *
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER                         *
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,                  *
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE                  *
+ * SOFTWARE.                                                                                      *
+ **************************************************************************************************/
+
+/**
+ * @file bignumSmall.cpp
+ * @brief This file contains the native-integer arithmetic for numbers that fit in a machine word.
+ *
+ * @author Andy Zhang
+ * @date 16th October 2026
+ */
+
+#include "bignum.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+
+namespace steppable::__internals::bignum
+{
+    namespace
+    {
+#ifdef __SIZEOF_INT128__
+        /// @brief A double-width magnitude, for intermediate results that do not fit in 64 bits.
+        using Wide = unsigned __int128;
+#else
+        /// @brief Without 128-bit integers, intermediate results are limited to 64 bits.
+        using Wide = std::uint64_t;
+#endif
+
+        /// @brief The largest value a double-width magnitude can hold.
+        constexpr Wide WIDE_MAX = ~Wide{ 0 };
+
+        /**
+         * @struct WideDecimal
+         * @brief A small number with a double-width mantissa, for intermediate results.
+         */
+        struct WideDecimal
+        {
+            Wide mantissa = 0; ///< The digits of the number.
+            long long exponent = 0; ///< The power of ten the mantissa is multiplied by.
+            bool negative = false; ///< Whether the number is negative.
+        };
+
+        /**
+         * @brief Multiplies a magnitude by a power of ten.
+         *
+         * @param[in,out] mantissa The magnitude to scale.
+         * @param[in] digits The power of ten.
+         * @return True if the result fits, false otherwise.
+         */
+        bool scaleUp(Wide& mantissa, long long digits)
+        {
+            for (; digits > 0 and mantissa != 0; digits--)
+            {
+                if (mantissa > WIDE_MAX / 10)
+                    return false;
+                mantissa *= 10;
+            }
+            return true;
+        }
+
+        /**
+         * @brief Counts the decimal digits of a magnitude.
+         *
+         * @param[in] mantissa The magnitude.
+         * @return The number of digits, 0 for zero.
+         */
+        long long countDigits(Wide mantissa)
+        {
+            long long digits = 0;
+            for (; mantissa != 0; mantissa /= 10)
+                digits++;
+            return digits;
+        }
+
+        /**
+         * @brief Converts a double-width number back to a small number.
+         *
+         * @param[in] number The number to convert.
+         * @param[out] out The converted number.
+         * @return True if the mantissa fits in 64 bits, false otherwise.
+         */
+        bool narrow(const WideDecimal& number, SmallDecimal& out)
+        {
+            if (number.mantissa > std::numeric_limits<std::uint64_t>::max())
+                return false;
+            out.mantissa = static_cast<std::uint64_t>(number.mantissa);
+            out.exponent = number.exponent;
+            out.negative = number.negative and number.mantissa != 0;
+            return true;
+        }
+
+        /**
+         * @brief Removes trailing zeros after the decimal point of a double-width number.
+         * @param[in,out] number The number to process.
+         */
+        void stripTrailingZeros(WideDecimal& number)
+        {
+            if (number.exponent >= 0)
+                return;
+            if (number.mantissa == 0)
+            {
+                number.exponent = 0;
+                return;
+            }
+            while (number.exponent < 0 and number.mantissa % 10 == 0)
+            {
+                number.mantissa /= 10;
+                number.exponent++;
+            }
+        }
+
+        /**
+         * @brief Rounds a double-width number off to a fixed number of decimal places, half away from zero.
+         *
+         * @param[in,out] number The number to round.
+         * @param[in] decimals The number of decimal places to keep.
+         * @return True if the rounded number fits, false otherwise.
+         */
+        bool roundOff(WideDecimal& number, const long long decimals)
+        {
+            if (number.exponent >= 0 or number.exponent == -decimals)
+                return true;
+            if (number.exponent > -decimals)
+            {
+                if (not scaleUp(number.mantissa, number.exponent + decimals))
+                    return false;
+                number.exponent = -decimals;
+                return true;
+            }
+
+            for (long long dropped = -decimals - number.exponent; dropped > 1 and number.mantissa != 0; dropped--)
+                number.mantissa /= 10;
+            const auto firstDropped = number.mantissa % 10;
+            number.mantissa /= 10;
+            if (firstDropped >= 5)
+                number.mantissa++;
+            number.exponent = -decimals;
+            number.negative = number.negative and number.mantissa != 0;
+            return true;
+        }
+
+        /**
+         * @brief Brings two small numbers to the same exponent.
+         *
+         * @param[in] a The first number.
+         * @param[in] b The second number.
+         * @param[out] aMantissa The mantissa of a at the common exponent.
+         * @param[out] bMantissa The mantissa of b at the common exponent.
+         * @return True if both mantissas fit, false otherwise.
+         */
+        bool align(const SmallDecimal& a, const SmallDecimal& b, Wide& aMantissa, Wide& bMantissa)
+        {
+            const long long exponent = std::min(a.exponent, b.exponent);
+            aMantissa = a.mantissa;
+            bMantissa = b.mantissa;
+            return scaleUp(aMantissa, a.exponent - exponent) and scaleUp(bMantissa, b.exponent - exponent);
+        }
+    } // namespace
+
+    bool parse(const std::string_view string, SmallDecimal& out)
+    {
+        size_t start = 0;
+        bool negative = false;
+        while (start < string.size() and (string[start] == '-' or string[start] == '+'))
+        {
+            if (string[start] == '-')
+                negative = not negative;
+            start++;
+        }
+
+        constexpr auto max = std::numeric_limits<std::uint64_t>::max();
+        std::uint64_t mantissa = 0;
+        size_t digitCount = 0;
+        size_t pointPos = std::string_view::npos;
+        for (size_t i = start; i < string.size(); i++)
+        {
+            if (string[i] == '.' and pointPos == std::string_view::npos)
+                pointPos = i;
+            else if (string[i] >= '0' and string[i] <= '9')
+            {
+                const auto digit = static_cast<std::uint64_t>(string[i] - '0');
+                if (mantissa > (max - digit) / 10)
+                    return false;
+                mantissa = (mantissa * 10) + digit;
+                digitCount++;
+            }
+            else
+                return false;
+        }
+        if (digitCount == 0)
+            return false;
+
+        out.mantissa = mantissa;
+        out.exponent = pointPos == std::string_view::npos ? 0 : -static_cast<long long>(string.size() - pointPos - 1);
+        out.negative = negative and mantissa != 0;
+        return true;
+    }
+
+    bool narrow(const BigDecimal& number, SmallDecimal& out)
+    {
+        constexpr auto max = std::numeric_limits<std::uint64_t>::max();
+        std::uint64_t mantissa = 0;
+        for (size_t i = number.mantissa.size(); i-- > 0;)
+        {
+            if (mantissa > (max - number.mantissa[i]) / LIMB_BASE)
+                return false;
+            mantissa = (mantissa * LIMB_BASE) + number.mantissa[i];
+        }
+        out.mantissa = mantissa;
+        out.exponent = number.exponent;
+        out.negative = number.negative and mantissa != 0;
+        return true;
+    }
+
+    bool toInteger(const BigDecimal& number, long long& out)
+    {
+        auto integer = number;
+        stripTrailingZeros(integer);
+        SmallDecimal small;
+        if (not integer.isInteger() or not narrow(integer, small))
+            return false;
+
+        constexpr auto max = static_cast<std::uint64_t>(std::numeric_limits<long long>::max());
+        for (; small.exponent > 0; small.exponent--)
+        {
+            if (small.mantissa > max / 10)
+                return false;
+            small.mantissa *= 10;
+        }
+        if (small.mantissa > max)
+            return false;
+        out = small.negative ? -static_cast<long long>(small.mantissa) : static_cast<long long>(small.mantissa);
+        return true;
+    }
+
+    BigDecimal widen(const SmallDecimal& number)
+    {
+        auto result = fromInteger(number.mantissa);
+        result.exponent = number.exponent;
+        result.negative = number.negative and not result.isZero();
+        return result;
+    }
+
+    void stripTrailingZeros(SmallDecimal& number)
+    {
+        WideDecimal wide{ .mantissa = number.mantissa, .exponent = number.exponent, .negative = number.negative };
+        stripTrailingZeros(wide);
+        narrow(wide, number);
+    }
+
+    std::strong_ordering compare(const SmallDecimal& a, const SmallDecimal& b)
+    {
+        const int aSign = a.isZero() ? 0 : (a.negative ? -1 : 1);
+        const int bSign = b.isZero() ? 0 : (b.negative ? -1 : 1);
+        if (aSign != bSign)
+            return aSign <=> bSign;
+        if (aSign == 0)
+            return std::strong_ordering::equal;
+
+        auto result = std::strong_ordering::equal;
+        Wide aMantissa = 0;
+        Wide bMantissa = 0;
+        if (const long long aTop = countDigits(a.mantissa) + a.exponent, bTop = countDigits(b.mantissa) + b.exponent;
+            aTop != bTop)
+            result = aTop <=> bTop;
+        else if (align(a, b, aMantissa, bMantissa))
+            result = aMantissa <=> bMantissa;
+        else
+            return compare(widen(a), widen(b));
+        return aSign > 0 ? result : 0 <=> result;
+    }
+
+    bool add(const SmallDecimal& a, const SmallDecimal& b, SmallDecimal& out)
+    {
+        Wide aMantissa = 0;
+        Wide bMantissa = 0;
+        if (not align(a, b, aMantissa, bMantissa))
+            return false;
+
+        WideDecimal result{ .exponent = std::min(a.exponent, b.exponent) };
+        if (a.negative == b.negative)
+        {
+            if (aMantissa > WIDE_MAX - bMantissa)
+                return false;
+            result.mantissa = aMantissa + bMantissa;
+            result.negative = a.negative;
+        }
+        else if (aMantissa >= bMantissa)
+        {
+            result.mantissa = aMantissa - bMantissa;
+            result.negative = a.negative;
+        }
+        else
+        {
+            result.mantissa = bMantissa - aMantissa;
+            result.negative = b.negative;
+        }
+        return narrow(result, out);
+    }
+
+    bool subtract(const SmallDecimal& a, const SmallDecimal& b, SmallDecimal& out)
+    {
+        SmallDecimal negated = b;
+        negated.negative = not b.negative and not b.isZero();
+        return add(a, negated, out);
+    }
+
+    bool multiply(const SmallDecimal& a, const SmallDecimal& b, const long long decimals, SmallDecimal& out)
+    {
+        Wide mantissa = a.mantissa;
+        if (b.mantissa != 0 and mantissa > WIDE_MAX / b.mantissa)
+            return false;
+        mantissa *= b.mantissa;
+
+        WideDecimal result{ .mantissa = mantissa,
+                            .exponent = a.exponent + b.exponent,
+                            .negative = a.negative != b.negative };
+        stripTrailingZeros(result);
+        return roundOff(result, decimals) and narrow(result, out);
+    }
+
+    bool roundOff(const SmallDecimal& number, const long long decimals, SmallDecimal& out)
+    {
+        WideDecimal result{ .mantissa = number.mantissa, .exponent = number.exponent, .negative = number.negative };
+        return roundOff(result, decimals) and narrow(result, out);
+    }
+
+    bool divideRounded(const SmallDecimal& a, const SmallDecimal& b, const long long decimals, SmallDecimal& out)
+    {
+        // Keep one more digit for rounding, as divideRounded() does for BigDecimal.
+        const long long shift = a.exponent - b.exponent + decimals + 1;
+        Wide numerator = a.mantissa;
+        Wide denominator = b.mantissa;
+        if (not scaleUp(shift >= 0 ? numerator : denominator, shift >= 0 ? shift : -shift))
+            return false;
+
+        Wide quotient = numerator / denominator;
+        const auto lastDigit = quotient % 10;
+        quotient /= 10;
+
+        WideDecimal result{ .mantissa = quotient, .exponent = -decimals, .negative = a.negative != b.negative };
+        if (decimals > 0 and quotient == 0)
+            result = {};
+        else if (decimals > 0 and lastDigit >= 5)
+            result.mantissa++;
+        return narrow(result, out);
+    }
+} // namespace steppable::__internals::bignum
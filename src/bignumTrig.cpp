@@ -0,0 +1,192 @@
+/**************************************************************************************************
+ * Copyright (c) 2023-2025 NWSOFT                                                                 *
+ *                                                                                                *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy                   *
+ * of this software and associated documentation files (the "Software"), to deal                  *
+ * in the Software without restriction, including without limitation the rights                   *
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell                      *
+ * copies of the Software, and to permit persons to whom the Software is                          *
+ * furnished to do so, subject to the following conditions:                                       *
+ *                                                                                                *
+ * The above copyright notice and this permission notice shall be included in all                 *
+ * copies or substantial portions of the Software.                                                *
+ *                                                                                                *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR                     *
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,                       *
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE                    *
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER                         *
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,                  *
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE                  *
+ * SOFTWARE.                                                                                      *
+ **************************************************************************************************/
+
+/**
+ * @file bignumTrig.cpp
+ * @brief This file contains the trigonometric functions of the limb-based backend.
+ *
+ * @author Andy Zhang
+ * @date 16th October 2026
+ */
+
+#include "bignum.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <utility>
+#include <vector>
+
+namespace steppable::__internals::bignum
+{
+    namespace
+    {
+        /// @brief Extra digits carried through the calculation, so that the result can be rounded correctly.
+        constexpr long long GUARD_DIGITS = 10;
+
+        /**
+         * @brief Calculates sin(r) and cos(r) for |r| < 1, rotating by the angle of each of r's digit groups.
+         *
+         * @param r The argument.
+         * @param decimals The number of decimal places of the result.
+         * @return sin(r) and cos(r), accurate to a few units in the last place.
+         */
+        SineCosine sincosReduced(const BigDecimal& r, const long long decimals)
+        {
+            SineCosine result{ .sine = { .exponent = -decimals }, .cosine = fromInteger(1) };
+            for (const auto& group : splitDigitGroups(r, decimals))
+            {
+                // sin(a / 10^e) = sum (-1)^k a^(2k + 1) / ((2k + 1)! 10^(e (2k + 1)))
+                // cos(a / 10^e) = sum (-1)^k a^(2k) / ((2k)! 10^(2ek))
+                auto square = multiply(group.numerator, group.numerator);
+                square.negative = true;
+                const auto end = group.end;
+                const HypergeometricSeries sineSeries{
+                    .p = [&](const long long k) { return k == 0 ? group.numerator : square; },
+                    .q = [end](const long long k) {
+                        if (k == 0)
+                            return BigDecimal{ .mantissa = { 1 }, .exponent = end };
+                        auto denominator = fromInteger(2 * k * ((2 * k) + 1));
+                        denominator.exponent = 2 * end;
+                        return denominator;
+                    },
+                };
+                const HypergeometricSeries cosineSeries{
+                    .p = [&](const long long k) { return k == 0 ? fromInteger(1) : square; },
+                    .q = [end](const long long k) {
+                        if (k == 0)
+                            return fromInteger(1);
+                        auto denominator = fromInteger(((2 * k) - 1) * 2 * k);
+                        denominator.exponent = 2 * end;
+                        return denominator;
+                    },
+                };
+                const auto terms = (taylorTerms(group, decimals) / 2) + 2;
+                const auto sine = sumSeries(sineSeries, terms, decimals);
+                const auto cosine = sumSeries(cosineSeries, terms, decimals);
+
+                // sin(x + y) = sin x cos y + cos x sin y, cos(x + y) = cos x cos y - sin x sin y
+                auto nextSine = add(multiply(result.sine, cosine), multiply(result.cosine, sine));
+                auto nextCosine = subtract(multiply(result.cosine, cosine), multiply(result.sine, sine));
+                result.sine = roundOff(nextSine, decimals);
+                result.cosine = roundOff(nextCosine, decimals);
+            }
+            if (r.negative)
+                result.sine.negative = not result.sine.isZero();
+            return result;
+        }
+
+        /**
+         * @brief Negates a number, keeping zero non-negative.
+         *
+         * @param number The number.
+         * @return -number.
+         */
+        BigDecimal negate(BigDecimal number)
+        {
+            number.negative = not number.negative and not number.isZero();
+            return number;
+        }
+    } // namespace
+
+    SineCosine sincos(const BigDecimal& x, const long long decimals, const long long rightAngle)
+    {
+        const long long working = decimals + GUARD_DIGITS;
+        const BigDecimal half{ .mantissa = { 5 }, .exponent = -1 };
+
+        // x = q * (pi / 2) + r, where |r| <= pi / 4. Angles in degrees or grads are reduced exactly first.
+        BigDecimal quadrant;
+        BigDecimal r;
+        if (rightAngle != 0)
+        {
+            const auto quarter = fromInteger(rightAngle);
+            quadrant = roundOff(divideTruncated(x, quarter, 1), 0);
+            r = subtract(x, multiply(quadrant, quarter));
+            r = divideTruncated(multiply(r, pi(working + 3)), fromInteger(2 * rightAngle), working);
+        }
+        else
+        {
+            // |q| has as many digits as x, and each costs a place of pi / 2.
+            const long long integerDigits = std::max(countDigits(x.mantissa) + x.exponent, 1LL);
+            const auto halfPi = multiply(pi(working + integerDigits + 1), half);
+            quadrant = roundOff(divideTruncated(x, halfPi, 1), 0);
+            r = roundOff(subtract(x, multiply(quadrant, halfPi)), working);
+        }
+        rescale(quadrant, 0);
+
+        // 10^9 is a multiple of 4, so the lowest limb decides the quadrant.
+        long long turn = quadrant.mantissa.empty() ? 0 : quadrant.mantissa.front() % 4;
+        if (quadrant.negative)
+            turn = (4 - turn) % 4;
+
+        auto [sine, cosine] = sincosReduced(r, working);
+        switch (turn)
+        {
+        case 1:
+            // sin(pi / 2 + r) = cos(r), cos(pi / 2 + r) = -sin(r)
+            std::swap(sine, cosine);
+            cosine = negate(cosine);
+            break;
+        case 2:
+            sine = negate(sine);
+            cosine = negate(cosine);
+            break;
+        case 3:
+            // sin(-pi / 2 + r) = -cos(r), cos(-pi / 2 + r) = sin(r)
+            std::swap(sine, cosine);
+            sine = negate(sine);
+            break;
+        default:
+            break;
+        }
+        SineCosine result{ .sine = roundOff(sine, decimals), .cosine = roundOff(cosine, decimals) };
+        rescale(result.sine, -decimals);
+        rescale(result.cosine, -decimals);
+        return result;
+    }
+
+    BigDecimal atan2(const BigDecimal& y, const BigDecimal& x, const long long decimals)
+    {
+        // Only the ratio matters, so scale both to about 1 before seeding with doubles.
+        const long long scale = std::max(countDigits(y.mantissa) + y.exponent, countDigits(x.mantissa) + x.exponent);
+        auto scaledY = y;
+        auto scaledX = x;
+        scaledY.exponent -= scale;
+        scaledX.exponent -= scale;
+
+        // atan2(y, x) = t + atan((y cos t - x sin t) / (x cos t + y sin t)), and atan(u) = u + O(u^3), so every step
+        // triples the number of correct digits.
+        std::vector<long long> precisions;
+        for (long long precision = decimals + GUARD_DIGITS; precision > 14; precision = (precision / 3) + 2)
+            precisions.push_back(precision);
+
+        auto result = fromInteger(std::llround(std::atan2(toDouble(scaledY), toDouble(scaledX)) * 1e15));
+        result.exponent = -15;
+        for (auto precision = precisions.rbegin(); precision != precisions.rend(); ++precision)
+        {
+            const auto [sine, cosine] = sincos(result, *precision + 2);
+            const auto numerator = subtract(multiply(scaledY, cosine), multiply(scaledX, sine));
+            const auto denominator = add(multiply(scaledX, cosine), multiply(scaledY, sine));
+            result = roundOff(add(result, divideTruncated(numerator, denominator, *precision + 2)), *precision);
+        }
+        return roundOff(result, decimals);
+    }
+} // namespace steppable::__internals::bignum
@@ -1,5 +1,5 @@
 /**************************************************************************************************
- * Copyright (c) 2023-2025 NWSOFT                                                                 *
+ * Copyright (c) 2023-2026 NWSOFT                                                                 *
  *                                                                                                *
  * Permission is hereby granted, free of charge, to any person obtaining a copy                   *
  * of this software and associated documentation files (the "Software"), to deal                  *
@@ -39,6 +39,7 @@
 #include <iostream>
 #include <string>
 
+using namespace steppable::__internals::numUtils;
 using namespace steppable::__internals::utils;
 using namespace steppable::__internals::calc;
 using namespace steppable::localization;
@@ -53,7 +54,13 @@ namespace steppable::__internals::calc
         return { inputs, outputs, Number(result), types::Status::CALCULATED_UNSIMPLIFIED };
     }
 
-    std::string abs(const std::string& _number, const int steps) { return _abs(_number).getOutput(steps); }
+    std::string abs(const std::string& _number, const int steps)
+    {
+        // No report needed, drop the sign directly.
+        if (steps == 0)
+            return standardizeNumber(not _number.empty() and _number.front() == '-' ? _number.substr(1) : _number);
+        return _abs(_number).getOutput(steps);
+    }
 } // namespace steppable::__internals::calc
 
 #ifndef NO_MAIN
@@ -30,6 +30,7 @@
 
 #include "addReport.hpp"
 #include "argParse.hpp"
+#include "bignum.hpp"
 #include "fn/calc.hpp"
 #include "getString.hpp"
 #include "util.hpp"
@@ -86,6 +87,23 @@ namespace steppable::__internals::calc
 
             return ss.str();
         }
+
+        // No report needed, add on limbs directly.
+        if (bignum::BigDecimal aNumber, bNumber;
+            steps == 0 and properlyFormat and bignum::parse(a, aNumber) and bignum::parse(b, bNumber))
+        {
+            bignum::stripTrailingZeros(aNumber);
+            bignum::stripTrailingZeros(bNumber);
+            if (negative)
+            {
+                aNumber.negative = true;
+                bNumber.negative = true;
+            }
+            auto result = bignum::add(aNumber, bNumber);
+            bignum::stripTrailingZeros(result);
+            return bignum::toString(result);
+        }
+
         auto [splitNumberArray, aIsNegative, bIsNegative] = splitNumber(a, b, true, true, properlyFormat);
         auto [aInteger, aDecimal, bInteger, bDecimal] = splitNumberArray;
         bool resultIsNegative = false;
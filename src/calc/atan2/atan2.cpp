@@ -30,7 +30,7 @@
 
 #include "argParse.hpp"
 #include "atan2Report.hpp"
-#include "constants.hpp"
+#include "bignum.hpp"
 #include "fn/calc.hpp"
 #include "getString.hpp"
 #include "output.hpp"
@@ -83,29 +83,14 @@ namespace steppable::__internals::calc
             return "Undefined";
         }
 
-        // (4)
-        if (isZeroString(x) and compare(y, "0", 0) == "1") [[unlikely]]
-            return roundOff(static_cast<std::string>(constants::PI_OVER_2), decimals);
+        // All the other cases are covered by refining the angle with sin and cos of the guess.
+        bignum::BigDecimal yNumber;
+        bignum::BigDecimal xNumber;
+        if (bignum::parse(y, yNumber) and bignum::parse(x, xNumber)) [[likely]]
+            return bignum::toString(bignum::atan2(yNumber, xNumber, static_cast<long long>(decimals)));
 
-        // (5)
-        if (isZeroString(x) and compare(y, "0", 0) == "0") [[unlikely]]
-            return "-" + roundOff(static_cast<std::string>(constants::PI_OVER_2), decimals);
-
-        const auto& yOverX = divide(y, x, 0, static_cast<int>(decimals + 2));
-        const auto& atanYOverX = atan(yOverX, static_cast<int>(decimals + 2));
-
-        // (1)
-        if (compare(x, "0", 0) == "1") [[likely]]
-            return atanYOverX;
-        // (2)
-        if (compare(x, "0", 0) == "0" and compare(y, "0", 0) != "0") [[likely]]
-            return add(atanYOverX, static_cast<std::string>(constants::PI), 0);
-        // (3)
-        if (compare(x, "0", 0) == "0" and compare(y, "0", 0) == "0") [[likely]]
-            return subtract(atanYOverX, static_cast<std::string>(constants::PI), 0);
-
-        // Will never be executed. Just here for Clangd.
-        return "Impossible! How did you get here?";
+        error("atan2"s, $("atan2", "8d78a4a1-4b3e-431a-a0fc-9a0e663b3281"));
+        return "Undefined";
     }
 } // namespace steppable::__internals::calc
 
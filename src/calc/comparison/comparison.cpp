@@ -28,6 +28,7 @@
  * @date 9th October 2023
  */
 #include "argParse.hpp"
+#include "bignum.hpp"
 #include "comparisonReport.hpp"
 #include "fn/calc.hpp"
 #include "getString.hpp"
@@ -48,6 +49,18 @@ namespace steppable::__internals::calc
 {
     std::string compare(const std::string& _a, const std::string& _b, const int steps)
     {
+        // No report needed, compare the digits in place.
+        if (steps == 0)
+        {
+            const auto ordering = bignum::compare(_a, _b);
+            if (ordering < 0)
+                return "0";
+            if (ordering > 0)
+                return "1";
+            if (ordering == 0)
+                return "2";
+        }
+
         if (standardizeNumber(_a) == standardizeNumber(_b))
         {
             std::stringstream ss;
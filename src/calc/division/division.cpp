@@ -29,6 +29,7 @@
  */
 
 #include "argParse.hpp"
+#include "bignum.hpp"
 #include "divisionReport.hpp"
 #include "fn/calc.hpp"
 #include "getString.hpp"
@@ -52,13 +53,30 @@ namespace steppable::__internals::calc
     QuotientRemainder getQuotientRemainder(const auto& _currentRemainder, const auto& divisor)
     {
         auto currentRemainder = removeLeadingZeros(_currentRemainder);
-        if (compare(currentRemainder, divisor, 0) == "0")
+
+        // Non-negative integers are divided directly on limbs.
+        bignum::BigDecimal a;
+        bignum::BigDecimal b;
+        if (bignum::parse(currentRemainder, a) and bignum::parse(divisor, b) and not b.isZero())
+        {
+            bignum::stripTrailingZeros(a);
+            bignum::stripTrailingZeros(b);
+            if (a.isInteger() and b.isInteger() and not a.negative and not b.negative)
+            {
+                const auto& [quotient, remainder] = bignum::divideMagnitude(
+                    bignum::shiftLeftDigits(a.mantissa, a.exponent), bignum::shiftLeftDigits(b.mantissa, b.exponent));
+                return { .quotient = bignum::toString({ .mantissa = quotient }),
+                         .remainder = bignum::toString({ .mantissa = remainder }) };
+            }
+        }
+
+        if (bignum::compare(currentRemainder, divisor) < 0)
             return { "0", currentRemainder };
-        if (compare(currentRemainder, divisor, 0) == "2")
+        if (bignum::compare(currentRemainder, divisor) == 0)
             return { .quotient = "1", .remainder = "0" }; // Equal
 
         int out = 0;
-        while (compare(currentRemainder, divisor, 0) != "0")
+        while (bignum::compare(currentRemainder, divisor) >= 0)
         {
             out++;
             currentRemainder = subtract(currentRemainder, divisor, 0);
@@ -135,6 +153,17 @@ namespace steppable::__internals::calc
             return "0";
         }
 
+        // No report needed, divide on limbs. The shortcuts give the same results as the ones below.
+        if (bignum::BigDecimal numberValue, divisorValue;
+            steps == 0 and bignum::parse(_number, numberValue) and bignum::parse(_divisor, divisorValue))
+        {
+            if (bignum::compare(numberValue, divisorValue) == 0)
+                return "1";
+            if (bignum::compare(divisorValue, bignum::fromInteger(1)) == 0)
+                return bignum::toString(bignum::roundOff(numberValue, _decimals));
+            return bignum::toString(bignum::divideRounded(numberValue, divisorValue, _decimals));
+        }
+
         if (compare(_number, _divisor, 0) == "2")
         {
             std::stringstream ss;
@@ -275,6 +304,17 @@ namespace steppable::__internals::calc
 
     QuotientRemainder divideWithQuotient(const std::string& number, const std::string& divisor)
     {
+        bignum::BigDecimal numberValue;
+        bignum::BigDecimal divisorValue;
+        if (bignum::parse(number, numberValue) and bignum::parse(divisor, divisorValue) and not divisorValue.isZero())
+        {
+            // The quotient is truncated exactly, so the remainder always has the sign of the number.
+            const auto quotient = bignum::divideTruncated(numberValue, divisorValue, 0);
+            auto remainder = bignum::subtract(numberValue, bignum::multiply(divisorValue, quotient));
+            bignum::stripTrailingZeros(remainder);
+            return { .quotient = bignum::toString(quotient), .remainder = bignum::toString(remainder) };
+        }
+
         const auto& divisionResult = divide(number, divisor, 0);
         const auto& splitNumberResult = splitNumber(divisionResult, "0", false, false, true, true).splitNumberArray;
 
@@ -289,6 +329,11 @@ namespace steppable::__internals::calc
     {
         // Sign for GCD does not matter.
         // https://proofwiki.org/wiki/GCD_for_Negative_Integers
+        bignum::BigDecimal parsedA;
+        bignum::BigDecimal parsedB;
+        if (bignum::parse(_a, parsedA) and bignum::parse(_b, parsedB))
+            return bignum::toString(bignum::gcd(parsedA, parsedB));
+
         auto splitNumberResult = splitNumber(_a, _b, false, false, true, false).splitNumberArray;
         auto a = splitNumberResult[0] + splitNumberResult[1];
         auto b = splitNumberResult[2] + splitNumberResult[3];
@@ -29,6 +29,7 @@
  */
 
 #include "argParse.hpp"
+#include "bignum.hpp"
 #include "factorialReport.hpp"
 #include "fn/calc.hpp"
 #include "getString.hpp"
@@ -48,6 +49,39 @@ using namespace std::literals;
 
 namespace steppable::__internals::calc
 {
+    namespace
+    {
+        /**
+         * @brief Converts a non-negative integer to a native integer, reporting any other value.
+         *
+         * @param[in] number The number.
+         * @param[out] out The converted number.
+         * @return True if the number is a non-negative integer that fits, false otherwise.
+         */
+        bool parseNonNegative(const std::string& number, unsigned long long& out)
+        {
+            bignum::BigDecimal parsed;
+            long long integer = 0;
+            if (not bignum::parse(number, parsed) or not isInteger(number))
+            {
+                error("factorial"s, $("factorial", "4eeba5fa-a5b8-4abf-ae65-22a466da6d18", { number }));
+                return false;
+            }
+            if (parsed.negative)
+            {
+                error("factorial"s, $("factorial", "69d93fb8-1bb7-4ed2-be6d-8eeafd5f23a6", { number }));
+                return false;
+            }
+            if (not bignum::toInteger(parsed, integer))
+            {
+                error("factorial"s, $("factorial", "36b6612e-8125-4320-b45b-f0c78351c9d1", { number }));
+                return false;
+            }
+            out = static_cast<unsigned long long>(integer);
+            return true;
+        }
+    } // namespace
+
     std::string factorial(const std::string& _number, const int steps)
     {
         auto number = standardizeNumber(_number);
@@ -78,11 +112,19 @@ namespace steppable::__internals::calc
             return "0";
         }
 
-        // Calculate the factorial of the number
-        std::string result = "1";
-        loop(_number, [&](const std::string& i) { result = multiply(result, add(i, "1", 0), 0); });
+        unsigned long long n = 0;
+        if (not parseNonNegative(number, n))
+            return "0";
+        return reportFactorial(_number, bignum::toString(bignum::factorial(n)), steps);
+    }
 
-        return reportFactorial(_number, result, steps);
+    std::string binomial(const std::string& _n, const std::string& _k)
+    {
+        unsigned long long n = 0;
+        unsigned long long k = 0;
+        if (not parseNonNegative(standardizeNumber(_n), n) or not parseNonNegative(standardizeNumber(_k), k))
+            return "0";
+        return bignum::toString(bignum::binomial(n, k));
     }
 } // namespace steppable::__internals::calc
 
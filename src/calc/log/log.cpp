@@ -29,12 +29,14 @@
  */
 
 #include "argParse.hpp"
+#include "bignum.hpp"
 #include "fn/calc.hpp"
 #include "getString.hpp"
 #include "output.hpp"
 #include "rounding.hpp"
 #include "util.hpp"
 
+#include <algorithm>
 #include <cstdlib>
 #include <string>
 
@@ -49,7 +51,6 @@ namespace steppable::__internals::calc
     {
         checkDecimalArg(&_decimals);
 
-        const auto& decimals = _decimals + 2;
         // Zero check
         if (numUtils::isZeroString(x))
         {
@@ -59,48 +60,13 @@ namespace steppable::__internals::calc
         if (compare(x, "1", 0) == "2")
             return "0";
 
-        // ROUND 1 -- Padé approximant
-        //                                          2
-        //          3 * (x + 1) * (x - 1)     3 * (x  - 1)
-        // ln(x) = ----------------------- = --------------
-        //               2                     2
-        //              x  + 4x + 1           x  + 4x + 1
-        const auto& x2 = multiply(x, x, 0, static_cast<int>(decimals) + 2);
-        const auto& x2Minus1 = subtract(x2, "1", 0);
-        const auto& numerator = multiply("3", x2Minus1, 0, static_cast<int>(decimals) + 2);
-        const auto& fourX = multiply(x, "4", 0, static_cast<int>(decimals) + 2);
-
-        auto denominator = add(x2, fourX, 0);
-        denominator = add(denominator, "1", 0);
-
-        // ROUND 2 -- Newton's Method
-        //                    x - exp(y )
-        //                             n
-        // y      = y  + 2 * --------------
-        //  n + 1    n        x + exp(y )
-        //                             n
-
-        // ln(x) = y
-        //          n + 1
-
-        const auto& epsilon = "0." + std::string(_decimals + 1, '0') + "1";
-        auto yn = divide(numerator, denominator, 0, static_cast<int>(decimals) + 2);
-        auto yn1 = yn;
-
-        auto error = abs(subtract(yn, yn1, 0), 0);
-        do // NOLINT(cppcoreguidelines-avoid-do-while)
+        bignum::BigDecimal number;
+        if (not bignum::parse(x, number) or number.negative)
         {
-            yn = yn1;
-            auto expYN = exp(yn, decimals);
-            auto xMinusExpYN = subtract(x, expYN, 0);
-            auto xPlusExpYN = add(x, expYN, 0);
-            auto fraction = divide(xMinusExpYN, xPlusExpYN, 0, static_cast<int>(decimals));
-            auto twoXFraction = multiply(fraction, "2", 0, static_cast<int>(decimals));
-            yn1 = add(yn, twoXFraction, 0);
-            error = abs(subtract(yn, yn1, 0), 0);
-        } while (compare(error, epsilon, 0) == "1");
-
-        return numUtils::roundOff(yn1, _decimals);
+            output::error("log::_log"s, "The number must be positive."s);
+            return "NaN";
+        }
+        return bignum::toString(bignum::ln(number, static_cast<long long>(_decimals)));
     }
 
     // Common logarithms
@@ -108,18 +74,31 @@ namespace steppable::__internals::calc
     {
         checkDecimalArg(&_decimals);
 
-        //            -ln(1/a)
-        // log (x) = ----------
-        //    b       -ln(1/b)
-
-        auto oneOverA = divide("1", _number, 0, static_cast<int>(_decimals + 2));
-        auto oneOverB = divide("1", _base, 0, static_cast<int>(_decimals + 2));
+        //            ln(a)
+        // log (a) = -------
+        //    b       ln(b)
 
-        auto lnX = "-" + _log(oneOverA, _decimals + 2);
-        auto lnB = "-" + _log(oneOverB, _decimals + 2);
-        auto result = divide(lnX, lnB, 0, static_cast<int>(_decimals));
+        bignum::BigDecimal number;
+        bignum::BigDecimal base;
+        if (bignum::parse(_number, number) and bignum::parse(_base, base) and not number.isZero() and
+            not number.negative and not base.isZero() and not base.negative and
+            bignum::compare(base, bignum::fromInteger(1)) != 0)
+        {
+            // A ln(b) close to zero magnifies the error of both logarithms, so they get more places.
+            const auto decimals = static_cast<long long>(_decimals) + 5;
+            auto lnBase = bignum::ln(base, decimals);
+            const auto leadingZeros = std::max(0LL, -(bignum::countDigits(lnBase.mantissa) + lnBase.exponent));
+            if (leadingZeros > 0)
+                lnBase = bignum::ln(base, decimals + (2 * leadingZeros));
+            const auto lnNumber = bignum::ln(number, decimals + (2 * leadingZeros));
+            if (not lnBase.isZero())
+                return bignum::toString(bignum::divideRounded(lnNumber, lnBase, static_cast<long long>(_decimals)));
+        }
 
-        return numUtils::roundOff(result, _decimals);
+        // Leave the invalid arguments to ln, and the division by zero to divide.
+        const auto lnX = _log(_number, _decimals + 2);
+        const auto lnB = _log(_base, _decimals + 2);
+        return divide(lnX, lnB, 0, static_cast<int>(_decimals));
     }
 
     std::string log10(const std::string& _number, const size_t _decimals)
@@ -29,6 +29,7 @@
  */
 
 #include "argParse.hpp"
+#include "bignum.hpp"
 #include "fn/calc.hpp"
 #include "getString.hpp"
 #include "multiplyReport.hpp"
@@ -50,6 +51,34 @@ namespace steppable::__internals::calc
     // NOLINTNEXTLINE(readability-function-cognitive-complexity)
     std::string multiply(const std::string& _a, const std::string& _b, const int steps, const int decimals)
     {
+        // No report needed, multiply on limbs. The shortcuts give the same results as the ones below.
+        if (bignum::BigDecimal aNumber, bNumber;
+            steps == 0 and bignum::parse(_a, aNumber) and bignum::parse(_b, bNumber))
+        {
+            if (aNumber.isZero() or bNumber.isZero())
+                return "0";
+            const auto one = bignum::fromInteger(1);
+            const auto minusOne = bignum::fromInteger(-1);
+            if (bignum::compare(aNumber, one) == 0)
+                return _b;
+            if (bignum::compare(bNumber, one) == 0)
+                return _a;
+            if (bignum::compare(aNumber, minusOne) == 0)
+                return standardizeNumber("-" + _b);
+            if (bignum::compare(bNumber, minusOne) == 0)
+                return standardizeNumber("-" + _a);
+
+            const bool resultIsNegative = aNumber.negative != bNumber.negative;
+            if (isPowerOfTen(_a))
+                return (resultIsNegative ? "-" : "") + moveDecimalPlaces(_b, determineScale(_a));
+            if (isPowerOfTen(_b))
+                return (resultIsNegative ? "-" : "") + moveDecimalPlaces(_a, determineScale(_b));
+
+            bignum::stripTrailingZeros(aNumber);
+            bignum::stripTrailingZeros(bNumber);
+            return bignum::toString(bignum::roundOff(bignum::multiply(aNumber, bNumber), decimals));
+        }
+
         auto a = static_cast<std::string>(_a);
         auto b = static_cast<std::string>(_b);
         const auto& [splitNumberArray, aIsNegative, bIsNegative] = splitNumber(a, b, false, false);
@@ -69,6 +98,7 @@ namespace steppable::__internals::calc
             if (steps == 2)
                 out << $("multiply", "9cdeff33-fefa-40ac-b867-a811f652d6e3") << "\n";
             out << "0"; // Since a or b is zero, the result must be zero as well
+            return out.str();
         }
 
         // Multiplying by 1 gives the other number.
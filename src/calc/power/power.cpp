@@ -28,6 +28,7 @@
  * @date 8rd November 2023
  */
 #include "argParse.hpp"
+#include "bignum.hpp"
 #include "constants.hpp"
 #include "fn/calc.hpp"
 #include "steppable/fraction.hpp"
@@ -93,6 +94,14 @@ namespace steppable::__internals::calc
             return "0";
         }
 
+        // Without steps to show, the power is taken by squaring.
+        bignum::BigDecimal base;
+        bignum::BigDecimal parsedExponent;
+        long long exponent = 0;
+        if (steps == 0 and bignum::parse(number, base) and not base.isZero() and
+            bignum::parse(raiseTo, parsedExponent) and bignum::toInteger(parsedExponent, exponent))
+            return bignum::toString(bignum::power(base, exponent, decimals));
+
         auto numberNoTrailingZeros = standardizeNumber(number);
         size_t numberTrailingZeros = 0;
         auto result = splitNumber(number, "0", false, false, true, true);
@@ -118,34 +127,15 @@ namespace steppable::__internals::calc
         return reportPower(number, raiseTo, numberTrailingZeros, negativePower, steps, decimals);
     }
 
-    std::string _exp(const std::string& x, const size_t decimals) // NOLINT(*-no-recursion)
+    std::string exp(const std::string& x, const size_t decimals)
     {
-        if (compare(x, "4", 0) == "1")
-        {
-            std::string halfX = divide(x, "2", 0, static_cast<int>(decimals) + 2);
-            std::string result = _exp(halfX, decimals + 2);
-            return multiply(result, result, 0, static_cast<int>(decimals + 2));
-        }
-
-        std::string sum = "1";
-        std::string term = "1";
-        const auto errorStr = "0." + std::string(decimals + 1, '0') + "1";
-        for (int i = 1;; i++)
+        bignum::BigDecimal exponent;
+        if (not bignum::parse(x, exponent))
         {
-            std::string frac = divide(x, std::to_string(i), 0, static_cast<int>(decimals) + 2);
-            term = multiply(term, frac, 0, static_cast<int>(decimals) + 2);
-            if (compare(term, errorStr, 0) != "1")
-                break;
-
-            sum = add(sum, term, 0);
+            error("exp"s, $("power", "dc46041f-2d8e-46a1-aa4c-1a787371440c", { x }));
+            return "0";
         }
-        return roundOff(sum, decimals);
-    }
-
-    std::string exp(const std::string& x, const size_t decimals)
-    {
-        const auto result = _exp(x, decimals + 2);
-        return roundOff(result, decimals);
+        return bignum::toString(bignum::exp(exponent, static_cast<long long>(decimals)));
     }
 } // namespace steppable::__internals::calc
 
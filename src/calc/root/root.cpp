@@ -31,10 +31,12 @@
 #include "fn/root.hpp"
 
 #include "argParse.hpp"
+#include "bignum.hpp"
 #include "factors.hpp"
 #include "fn/calc.hpp"
 #include "steppable/fraction.hpp"
 #include "getString.hpp"
+#include "output.hpp"
 #include "rootReport.hpp"
 #include "rounding.hpp"
 #include "symbols.hpp"
@@ -89,6 +91,43 @@ namespace steppable::prettyPrint::printers
 
 namespace steppable::__internals::calc
 {
+    namespace
+    {
+        /**
+         * @brief Parses the radicand and the index of a root, reporting the one that is not valid.
+         *
+         * @param[in] _number The radicand.
+         * @param[in] base The index of the root.
+         * @param[out] radicand The parsed radicand.
+         * @param[out] index The parsed index.
+         * @return True if both are valid, false otherwise.
+         */
+        bool parseRoot(const std::string& _number,
+                       const std::string& base,
+                       bignum::BigDecimal& radicand,
+                       unsigned long long& index)
+        {
+            if (not bignum::parse(_number, radicand))
+            {
+                output::error("root"s, $("root", "f9ccab48-34de-49cd-a3fd-ab8968ddf90f", { _number }));
+                return false;
+            }
+
+            bignum::BigDecimal parsedIndex;
+            bignum::SmallDecimal smallIndex;
+            if (bignum::parse(base, parsedIndex))
+                bignum::stripTrailingZeros(parsedIndex);
+            if (parsedIndex.negative or parsedIndex.isZero() or not parsedIndex.isInteger() or
+                not bignum::narrow(parsedIndex, smallIndex) or smallIndex.exponent != 0)
+            {
+                output::error("root"s, $("root", "a593124c-2d1e-4c00-8c1e-5e661465332b", { base }));
+                return false;
+            }
+            index = smallIndex.mantissa;
+            return true;
+        }
+    } // namespace
+
     std::string rootIntPart(const std::string& _number, const std::string& base)
     {
         if (compare(_number, "1", 0) == "0")
@@ -98,29 +137,22 @@ namespace steppable::__internals::calc
         if (compare(base, "1", 0) == "2")
             return numUtils::roundDown(_number); // Root with index 1 returns the number itself.
 
-        auto number = numUtils::roundDown(_number);
-        auto x = number;
-        auto y = "0"s;
-        while (true)
-        {
-            auto newAvg = divide(subtract(x, y, 0), "2", 0, 2);
-            auto radicand = add(y, newAvg, 0);
-            auto test = power(radicand, base, 0);
-
-            if (compare(newAvg, "0", 0) == "2" or compare(test, number, 0) == "2")
-                return roundDown(roundOff(radicand, 1));
-            if (compare(test, number, 0) == "1")
-                x = radicand;
-            else if (compare(test, number, 0) == "0")
-                y = radicand;
-        }
+        bignum::BigDecimal number;
+        unsigned long long index = 0;
+        if (not parseRoot(_number, base, number, index))
+            return "0";
+        return bignum::toString(bignum::nthRoot(number, index, 0));
     }
 
     Surd rootSurd(const std::string& _number, const std::string& base)
     {
         auto largestRootFactor = numUtils::getRootFactor(_number, base);
-        auto radicand = roundDown(divide(_number, largestRootFactor.getOutput(), 0, 1));
         auto multiplier = largestRootFactor.getInputs()[2];
+        bignum::BigDecimal number;
+        bignum::BigDecimal factor;
+        if (not bignum::parse(_number, number) or not bignum::parse(largestRootFactor.getOutput(), factor))
+            return { .radicand = _number, .multiplier = "1" };
+        auto radicand = bignum::toString(bignum::divideTruncated(number, factor, 0));
 
         return { .radicand = radicand, .multiplier = multiplier };
     }
@@ -141,49 +173,20 @@ namespace steppable::__internals::calc
         if (compare(base, "1", 0) == "2")
             return _number;
 
-        auto decimals = _decimals + 1;
-        size_t raisedTimes = 0;
-        std::string number = static_cast<std::string>(_number);
-        while (compare(number, "1", 0) == "0")
-        {
-            number = multiply(number, power("10", base, 0), 0, static_cast<int>(decimals));
-            raisedTimes++;
-        }
-
-        auto x = number;
-        auto y = "0"s;
-        size_t idx = 0;
-        auto denominator = "1" + std::string(raisedTimes, '0');
-
-        while (true)
-        {
-            // Try to approximate the correct radicand.
-            // Method:
-            // +---+    *********    +---+
-            // | y | <= * value * <= | x |
-            // +---+    *********    +---+
-            //                x - y
-            // - value = y + -------
-            //                  2
-            //
-            //           base
-            // - If value     > actual, x is too large, exchange x with y.
-            // - If           < actual, y is too large, exchange y with x.
-            // - If           is within acceptable range, return.
-            auto newAvg = divide(subtract(x, y, 0), "2", 0, static_cast<int>(decimals) + 1);
-            auto radicand = add(y, newAvg, 0);
-            auto test = power(radicand, base, 0);
-
-            if (compare(newAvg, "0", 0) == "2" or compare(test, number, 0) == "2")
-                return numUtils::standardizeNumber(divide(radicand, denominator, 0, static_cast<int>(_decimals)));
-            if (compare(test, number, 0) == "1")
-                x = radicand;
-            else if (compare(test, number, 0) == "0")
-                y = radicand;
-
-            idx++;
-            // std::cout << "iteration: " << idx << " error: " << error << " test: " << test << "\n";
-        }
+        bignum::BigDecimal radicand;
+        unsigned long long index = 0;
+        if (not parseRoot(_number, base, radicand, index))
+            return "0";
+        const bool negative = radicand.negative;
+        if (negative and index % 2 == 0)
+            return "NaN";
+        radicand.negative = false;
+
+        // The root is truncated, so it is taken to one more place and rounded off.
+        const auto decimals = static_cast<long long>(_decimals);
+        auto result = bignum::roundOff(bignum::nthRoot(radicand, index, decimals + 1), decimals);
+        result.negative = negative and not result.isZero();
+        return bignum::toString(result);
     }
 
     std::string root(const std::string& _number, const std::string& base, const size_t _decimals, const int steps)
@@ -192,13 +195,6 @@ namespace steppable::__internals::calc
 
         if (isZeroString(_number))
             return "0";
-        if (isInteger(_number))
-        {
-            auto result = rootSurd(_number, base);
-            auto rootResult = _root(result.radicand, base, _decimals, 0);
-            return multiply(rootResult, result.multiplier, 0, static_cast<int>(_decimals));
-        }
-
         return _root(_number, base, _decimals, steps);
     }
 } // namespace steppable::__internals::calc
@@ -30,6 +30,7 @@
  */
 
 #include "argParse.hpp"
+#include "bignum.hpp"
 #include "fn/calc.hpp"
 #include "getString.hpp"
 #include "steppable/number.hpp"
@@ -53,6 +54,16 @@ namespace steppable::__internals::calc
 {
     std::string subtract(const std::string& a, const std::string& b, const int steps, const bool noMinus)
     {
+        // No report needed, subtract on limbs directly.
+        if (bignum::BigDecimal aNumber, bNumber; steps == 0 and bignum::parse(a, aNumber) and bignum::parse(b, bNumber))
+        {
+            bignum::stripTrailingZeros(aNumber);
+            bignum::stripTrailingZeros(bNumber);
+            auto result = bignum::subtract(aNumber, bNumber);
+            bignum::stripTrailingZeros(result);
+            return bignum::toString(result);
+        }
+
         auto [splitNumberArray, aIsNegative, bIsNegative] = splitNumber(a, b);
         auto [aInteger, aDecimal, bInteger, bDecimal] = splitNumberArray;
         bool resultIsNegative = false;
@@ -29,7 +29,7 @@
  */
 
 #include "argParse.hpp"
-#include "constants.hpp"
+#include "bignum.hpp"
 #include "fn/calc.hpp"
 #include "fn/calculus.hpp"
 #include "getString.hpp"
@@ -37,6 +37,7 @@
 #include "trigReport.hpp"
 #include "util.hpp"
 
+#include <algorithm>
 #include <functional>
 #include <iostream>
 #include <string>
@@ -47,13 +48,122 @@ using namespace steppable::localization;
 using namespace steppable::__internals::utils;
 using namespace steppable::__internals::numUtils;
 
+namespace
+{
+    using namespace steppable::__internals;
+
+    /// @brief The decimal places of the angle conversions that are not given a precision.
+    constexpr long long CONVERSION_DECIMALS = 100;
+
+    /// @brief Extra places carried into the quotients of sines and cosines.
+    constexpr long long GUARD_DIGITS = 10;
+
+    /// @brief A part of the sine and cosine of an angle.
+    using SineCosinePart = bignum::BigDecimal bignum::SineCosine::*;
+
+    /**
+     * @brief Calculates a fraction of pi from the cached value.
+     *
+     * @param numerator The numerator of the fraction.
+     * @param denominator The denominator of the fraction.
+     * @param decimals The number of decimal places of the result.
+     * @return pi * numerator / denominator.
+     */
+    std::string piFraction(const long long numerator, const long long denominator, const long long decimals)
+    {
+        const auto scaled = bignum::multiply(bignum::pi(decimals + 3), bignum::fromInteger(numerator));
+        return bignum::toString(bignum::divideRounded(scaled, bignum::fromInteger(denominator), decimals));
+    }
+
+    /**
+     * @brief Gets the size of a right angle in the unit of a mode.
+     *
+     * @param mode 0 = radians, 1 = degrees, 2 = gradians.
+     * @param name The name of the calling function, for the error message.
+     * @return 0 for radians, 90 for degrees and 100 for gradians.
+     */
+    long long rightAngle(const int mode, const std::string& name)
+    {
+        switch (mode)
+        {
+        case 0:
+            return 0;
+        case 1:
+            return 90;
+        case 2:
+            return 100;
+        default:
+            error(name, "Invalid mode. Defaulting to radians."s);
+            return 0;
+        }
+    }
+
+    /**
+     * @brief Parses an angle, reporting an error if it is not a number.
+     *
+     * @param x The angle.
+     * @param out The parsed angle.
+     * @param name The name of the calling function, for the error message.
+     * @return True if the angle is a number.
+     */
+    bool parseAngle(const std::string& x, bignum::BigDecimal& out, const std::string& name)
+    {
+        if (bignum::parse(x, out))
+            return true;
+        error(name, $("trig", "bbf28e28-dd4d-427c-a726-bddacb5cb026", { x }));
+        return false;
+    }
+
+    /**
+     * @brief Divides parts of the sine and cosine of an angle, taken from a single reduction.
+     * @details A divisor close to zero magnifies the error of both parts, so they get more places.
+     *
+     * @param x The angle.
+     * @param decimals The number of decimal places of the result.
+     * @param mode 0 = radians, 1 = degrees, 2 = gradians.
+     * @param name The name of the calling function, for the error messages.
+     * @param numerator The part to divide, or nullptr for 1.
+     * @param denominator The part to divide by.
+     * @param undefinedKey The key of the error message when the divisor is zero.
+     * @return The quotient, or "Infinity" if the divisor is zero to `decimals + 1` places.
+     */
+    std::string sincosRatio(const std::string& x,
+                            const int decimals,
+                            const int mode,
+                            const std::string& name,
+                            const SineCosinePart numerator,
+                            const SineCosinePart denominator,
+                            const std::string& undefinedKey)
+    {
+        bignum::BigDecimal angle;
+        if (not parseAngle(x, angle, name))
+            return "NaN";
+
+        const auto unit = rightAngle(mode, name);
+        const long long precision = decimals + GUARD_DIGITS;
+        auto values = bignum::sincos(angle, precision, unit);
+        if (bignum::roundOff(values.*denominator, decimals + 1).isZero())
+        {
+            error(name, $("trig", undefinedKey));
+            return "Infinity";
+        }
+
+        const auto& divisor = values.*denominator;
+        const auto leadingZeros = std::max(0LL, -(bignum::countDigits(divisor.mantissa) + divisor.exponent));
+        if (leadingZeros > 0)
+            values = bignum::sincos(angle, precision + (2 * leadingZeros), unit);
+        const auto dividend = numerator == nullptr ? bignum::fromInteger(1) : values.*numerator;
+        return bignum::toString(bignum::divideRounded(dividend, values.*denominator, decimals));
+    }
+} // namespace
+
 namespace steppable::__internals::calc
 {
     std::string degToRad(const std::string& _deg)
     {
         // rad = deg * (pi / 180)
         auto deg = divideWithQuotient(_deg, "360").remainder;
-        auto rad = multiply(deg, static_cast<std::string>(constants::PI_OVER_180), 0);
+        auto rad = multiply(deg, piFraction(1, 180, CONVERSION_DECIMALS), 0);
         return rad;
     }
 
@@ -61,7 +171,7 @@ namespace steppable::__internals::calc
     {
         // rad = grad * (pi / 200)
         auto grad = divideWithQuotient(_grad, "400").remainder;
-        auto rad = multiply(grad, static_cast<std::string>(constants::PI_OVER_200), 0);
+        auto rad = multiply(grad, piFraction(1, 200, CONVERSION_DECIMALS), 0);
         return rad;
     }
 
@@ -69,9 +179,9 @@ namespace steppable::__internals::calc
     {
         // deg = rad * (180 / pi)
         auto rad = _rad;
-        rad = divideWithQuotient(rad, static_cast<std::string>(constants::TWO_PI)).remainder;
+        rad = divideWithQuotient(rad, piFraction(2, 1, CONVERSION_DECIMALS)).remainder;
         rad = standardizeNumber(rad);
-        auto deg = divide(rad, static_cast<std::string>(constants::PI_OVER_180), 0, decimals);
+        auto deg = divide(rad, piFraction(1, 180, CONVERSION_DECIMALS), 0, decimals);
         deg = standardizeNumber(deg);
         deg = divideWithQuotient(deg, "90").remainder;
         return standardizeNumber(deg);
@@ -80,9 +190,9 @@ namespace steppable::__internals::calc
     std::string radToGrad(const std::string& _rad, const int decimals)
     {
         // grad = rad * (200 / pi)
-        auto rad = divideWithQuotient(_rad, static_cast<std::string>(constants::TWO_PI)).remainder;
+        auto rad = divideWithQuotient(_rad, piFraction(2, 1, CONVERSION_DECIMALS)).remainder;
         rad = standardizeNumber(rad);
-        auto grad = divide(rad, static_cast<std::string>(constants::PI_OVER_200), 0, decimals);
+        auto grad = divide(rad, piFraction(1, 200, CONVERSION_DECIMALS), 0, decimals);
         grad = standardizeNumber(grad);
         grad = divideWithQuotient(grad, "100").remainder;
         return standardizeNumber(grad);
@@ -95,254 +205,97 @@ namespace steppable::__internals::calc
         return deg;
     }
 
-    std::string _cos(const std::string& x, const int _decimals)
-    {
-        int decimals = _decimals;
-        checkDecimalArg(&_decimals);
-
-        //          .,,.   .,    /=====================================================================\
-        //         //%,   .(     | NOTE: DO NOT CALL THIS METHOD DIRECTLY IN PRODUCTION CODE!          |
-        //       /%(       .,    |   /-\    THIS METHOD ONLY ACCEPTS RADIANS AS INPUT, AND DOES        |
-        //       %#,   #%%,(%#   |  / ! \  NOT ROUND CORRECTLY. CALL `cos(std::string x, int decimals) |
-        //       ,,/   ..  ,#(   | /-----\     INSTEAD!                                                |
-        //        .,/..,.*%&#%   \=====================================================================/
-        //         /%&&&%&@%&*  /
-        //       (( ((&&%&&#&#
-        //   ,#%(((#% *%#@@&#(*
-        // (##&&%##%%&@@#&@@@@@&&&   +------------+
-        // %@%&&&%%&&&. .&*@@@@@@@@& | Henri Padé |
-        // %&%&&&%&&&%&@&@@@@@@@@@@@ +------------+
-
-        if (compare(abs(x, 0), "0.001", 0) == "0") // If small, use polynomial approximant
-        {
-            // double x2 = x * x;
-            auto x2 = multiply(x, x, 0, decimals);
-            auto x4 = multiply(x2, x2, 0, decimals);
-            // (313*x^4 - 6900*x^2 + 15120)/(13*x^4 + 660*x^2 + 15120) // Padé approximant
-            //      4        2
-            //  313x  - 6900x  + 15120
-            // ------------------------
-            //     4       2
-            //  13x  + 660x  + 15120
-            auto a = add(subtract(multiply("313", x4, 0, decimals), multiply("6900", x2, 0, decimals), 0), "15120", 0);
-            auto b = add(add(multiply("13", x4, 0, decimals), multiply("660", x2, 0, decimals), 0), "15120", 0);
-            return standardizeNumber(divide(a, b, 0, decimals + 2));
-        }
-        // otherwise use recursion
-        // double C = cos(x / 4);
-        auto result = _cos(standardizeNumber(divide(x, "4", 0, decimals + 1)), decimals + 2);
-        auto result2 = roundOff(multiply(result, result, 0, decimals + 2), static_cast<long>(decimals) + 2);
-        // return 8 * C2 * (C2 - 1) + 1;
-        return standardizeNumber(
-            add(multiply("8", multiply(result2, subtract(result2, "1", 0), 0, decimals), 0), "1", 0));
-    }
-
-    std::string cos(const std::string& x, const int decimals, const int mode)
+    SineCosine sincos(const std::string& x, const int decimals, const int mode)
     {
         checkDecimalArg(&decimals);
 
         // Mode Options:
         // 0: Radians  (default)
-        // 1: Degrees  (converts to radians)
-        // 2: Gradians (converts to radians)
-        std::string result;
-        switch (mode)
-        {
-        case 0:
-        {
-            result = _cos(divideWithQuotient(x, static_cast<std::string>(constants::TWO_PI)).remainder, decimals + 2);
-            break;
-        }
-        case 1:
-        {
-            result = _cos(degToRad(x), decimals + 2);
-            break;
-        }
-        case 2:
-        {
-            result = _cos(gradToRad(x), decimals + 2);
-            break;
-        }
-        default:
-        {
-            error("trig::cos"s, "Invalid mode. Defaulting to radians."s);
-            result = _cos(x, decimals + 2);
-        }
-        }
+        // 1: Degrees  (reduced by exact right angles, then converted to radians)
+        // 2: Gradians (reduced by exact right angles, then converted to radians)
+        bignum::BigDecimal angle;
+        if (not parseAngle(x, angle, "trig::sincos"s))
+            return { .sine = "NaN", .cosine = "NaN" };
+        const auto& [sine, cosine] = bignum::sincos(angle, decimals, rightAngle(mode, "trig::sincos"s));
+        return { .sine = bignum::toString(sine), .cosine = bignum::toString(cosine) };
+    }
 
-        return roundOff(result, decimals);
+    std::string cos(const std::string& x, const int decimals, const int mode)
+    {
+        checkDecimalArg(&decimals);
+        return sincos(x, decimals, mode).cosine;
     }
 
     std::string sin(const std::string& x, const int decimals, const int mode)
     {
         checkDecimalArg(&decimals);
-
-        // Mode Options:
-        // 0: Radians  (default)
-        // 1: Degrees  (converts to radians)
-        // 2: Gradians (converts to radians)
-        std::string result;
-        switch (mode)
-        {
-        case 0:
-        {
-            result = cos(subtract(divideWithQuotient(x, static_cast<std::string>(constants::TWO_PI)).remainder,
-                                  static_cast<std::string>(constants::PI_OVER_2),
-                                  0),
-                         decimals);
-            break;
-        }
-        case 1:
-        {
-            result = cos(subtract(degToRad(x), static_cast<std::string>(constants::PI_OVER_2), 0), decimals);
-            break;
-        }
-        case 2:
-        {
-            result = cos(subtract(gradToRad(x), static_cast<std::string>(constants::PI_OVER_2), 0), decimals);
-            break;
-        }
-        default:
-        {
-            error("trig::sin"s, "Invalid mode. Defaulting to radians."s);
-            result = cos(subtract(x, static_cast<std::string>(constants::PI_OVER_2), 0), decimals);
-        }
-        }
-
-        return roundOff(result, decimals);
+        return sincos(x, decimals, mode).sine;
     }
 
     std::string tan(const std::string& x, const int decimals, const int mode)
     {
         checkDecimalArg(&decimals);
 
-        // Mode Options:
-        // 0: Radians  (default)
-        // 1: Degrees  (converts to radians)
-        // 2: Gradians (converts to radians)
-        std::string result;
-        switch (mode)
-        {
-        case 0:
-        {
-            auto cosX = cos(divideWithQuotient(x, static_cast<std::string>(constants::TWO_PI)).remainder, decimals + 1);
-            if (isZeroString(cosX))
-            {
-                error("trig::tan"s, $("trig", "a7ed4324-5cc3-48d2-9798-d3e743b809d3"));
-                return "Infinity";
-            }
-            result = divide(sin(x, decimals + 1), cosX, 0, decimals);
-            break;
-        }
-        case 1:
-        {
-            auto xRad = degToRad(x);
-            auto cosX = cos(xRad, decimals + 1);
-            if (isZeroString(cosX))
-            {
-                error("trig::tan"s, $("trig", "a7ed4324-5cc3-48d2-9798-d3e743b809d3"));
-                return "Infinity";
-            }
-            result = divide(sin(xRad, decimals + 1), cosX, 0, decimals);
-            break;
-        }
-        case 2:
-        {
-            auto xRad = gradToRad(x);
-            auto cosX = cos(xRad, decimals + 1);
-            if (isZeroString(cosX))
-            {
-                error("trig::tan"s, $("trig", "a7ed4324-5cc3-48d2-9798-d3e743b809d3"));
-                return "Infinity";
-            }
-            result = divide(sin(xRad, decimals + 1), cosX, 0, decimals);
-            break;
-        }
-        default:
-        {
-            error("trig::tan"s, "Invalid mode. Defaulting to radians."s);
-            result = divide(sin(x, decimals + 1), cos(x, decimals + 1), decimals);
-        }
-        }
-
-        return roundOff(result, decimals);
+        //            sin(x)
+        // tan(x) = ----------
+        //            cos(x)
+        return sincosRatio(x,
+                           decimals,
+                           mode,
+                           "trig::tan"s,
+                           &bignum::SineCosine::sine,
+                           &bignum::SineCosine::cosine,
+                           "a7ed4324-5cc3-48d2-9798-d3e743b809d3");
     }
 
     std::string csc(const std::string& x, const int decimals, const int mode)
     {
         checkDecimalArg(&decimals);
-
-        auto sinX = sin(x, decimals + 1, mode);
-        if (isZeroString(sinX))
-        {
-            error("trig::csc"s, $("trig", "0dd11fcc-bdd0-48d1-9b4a-7ebcccb4915f"));
-            return "Infinity";
-        }
-        return divide("1", sinX, 0, decimals);
+        return sincosRatio(
+            x, decimals, mode, "trig::csc"s, nullptr, &bignum::SineCosine::sine, "0dd11fcc-bdd0-48d1-9b4a-7ebcccb4915f");
     }
 
     std::string sec(const std::string& x, const int decimals, const int mode)
     {
         checkDecimalArg(&decimals);
-
-        auto cosX = cos(x, decimals + 1, mode);
-        if (isZeroString(cosX))
-        {
-            error("trig::sec"s, $("trig", "62792c6c-6751-4850-bf66-5e6366322cc0"));
-            return "Infinity";
-        }
-        return divide("1", cosX, 0, decimals);
+        return sincosRatio(x,
+                           decimals,
+                           mode,
+                           "trig::sec"s,
+                           nullptr,
+                           &bignum::SineCosine::cosine,
+                           "62792c6c-6751-4850-bf66-5e6366322cc0");
     }
 
     std::string cot(const std::string& x, const int decimals, const int mode)
     {
         checkDecimalArg(&decimals);
 
-        auto tanX = tan(x, decimals + 1, mode);
-        if (isZeroString(tanX))
-        {
-            error("trig::cot"s, $("trig", "65650a93-4298-4e19-8c81-f5fbd9f14ac2"));
-            return "Infinity";
-        }
-        return divide("1", tanX, 0, decimals);
+        //            cos(x)
+        // cot(x) = ----------
+        //            sin(x)
+        return sincosRatio(x,
+                           decimals,
+                           mode,
+                           "trig::cot"s,
+                           &bignum::SineCosine::cosine,
+                           &bignum::SineCosine::sine,
+                           "65650a93-4298-4e19-8c81-f5fbd9f14ac2");
     }
 
-    std::string atan(const std::string& _x, const int decimals, const int mode)
+    std::string atan(const std::string& x, const int decimals, const int mode)
     {
         checkDecimalArg(&decimals);
 
-        auto x = _x;
         // Zero check
         if (isZeroString(x))
             return "0";
 
-        bool isReduced = false;
-        if (compare(abs(x, 0), "1", 0) != "0")
-        {
-            isReduced = true;
-            // Reduce x to a small number
-            x = divide("1", x, 0, decimals + 2);
-        }
-        // Otherwise, use integration.
-        //                      1                       / x
-        //   d              ---------  ==>              |       1
-        // ---- arctan(x) =     2           arctan(x) = |   ----------  dt
-        //  dx                 x + 1                    |      2
-        //                                              / 0   t  + 1
-        auto fx = [&](const std::string& y) {
-            const auto& y2 = multiply(y, y, 0);
-            const auto& denominator = add(y2, "1", 0);
-            return divide("1", denominator, 0, decimals * 2);
-        };
-        auto result = calculus::romberg(fx, "0", x, 10, decimals + 2);
-        if (isReduced)
-        {
-            // If x was reduced, use the identity
-            //              pi            1
-            // arctan(x) = ---- - arctan(---)
-            //               2            x
-            result = subtract(static_cast<std::string>(constants::PI_OVER_2), result, 0);
-        }
+        // arctan(x) = atan2(x, 1)
+        bignum::BigDecimal number;
+        if (not parseAngle(x, number, "trig::atan"s))
+            return "NaN";
+        auto result = bignum::toString(bignum::atan2(number, bignum::fromInteger(1), decimals + 2));
 
         // Convert the result as needed.
         switch (mode)
@@ -357,8 +310,6 @@ namespace steppable::__internals::calc
             break;
         }
 
-        if (_x.front() == '-')
-            result = "-" + result;
         return roundOff(result, decimals);
     }
 
@@ -420,7 +371,7 @@ namespace steppable::__internals::calc
             circleAngle = "100";
             break;
         default:
-            circleAngle = static_cast<std::string>(constants::PI_OVER_2);
+            circleAngle = piFraction(1, 2, decimals + 2);
         }
 
         //             pi
@@ -22,6 +22,7 @@
 
 #include "factors.hpp"
 
+#include "bignum.hpp"
 #include "fn/calc.hpp"
 #include "types/result.hpp"
 
@@ -33,6 +34,26 @@ using namespace steppable::types;
 
 namespace steppable::__internals::numUtils
 {
+    namespace
+    {
+        /**
+         * @brief Raises an integer to the power of an integer, with the limb-based backend where possible.
+         *
+         * @param[in] number The base.
+         * @param[in] exponent The exponent.
+         * @return number^exponent.
+         */
+        std::string integerPower(const std::string& number, const std::string& exponent)
+        {
+            bignum::BigDecimal base;
+            bignum::SmallDecimal smallExponent;
+            if (bignum::parse(number, base) and bignum::parse(exponent, smallExponent) and
+                smallExponent.exponent == 0 and not smallExponent.negative)
+                return bignum::toString(bignum::power(base, smallExponent.mantissa));
+            return power(number, exponent, 0);
+        }
+    } // namespace
+
     std::vector<std::string> getFactors(const std::string& _number)
     {
         std::vector<std::string> factors;
@@ -40,55 +61,69 @@ namespace steppable::__internals::numUtils
         if (_number[0] == '-')
             factors.emplace_back("-1");
         // Get the absolute value of the number
-        auto number = abs(_number, 0);
-        // Get the factors of the number
-        loop(number, [&](const std::string& factor) {
-            if (factor != "0")
+        bignum::BigDecimal number;
+        if (not bignum::parse(_number, number) or number.isZero())
+        {
+            factors.push_back(abs(_number, 0));
+            return factors;
+        }
+        number.negative = false;
+
+        // Every divisor takes each prime p^e of the factorization to a power between 0 and e.
+        std::vector<bignum::BigDecimal> divisors{ bignum::fromInteger(1) };
+        for (const auto& [prime, exponent] : bignum::factorize(number))
+        {
+            const auto count = divisors.size();
+            auto primePower = bignum::fromInteger(1);
+            for (unsigned long long k = 1; k <= exponent; k++)
             {
-                auto quotientRemainder = divideWithQuotient(number, factor);
-                if (quotientRemainder.remainder == "0")
-                    factors.push_back(factor);
+                primePower = bignum::multiply(primePower, prime);
+                for (size_t i = 0; i < count; i++)
+                    divisors.push_back(bignum::multiply(divisors[i], primePower));
             }
-        });
-        factors.push_back(number);
+        }
+        std::ranges::sort(divisors, [](const auto& a, const auto& b) { return bignum::compare(a, b) < 0; });
+        for (const auto& divisor : divisors)
+            factors.push_back(bignum::toString(divisor));
         return factors;
     }
 
     ResultBool<std::string> getRootFactor(const std::string& _number, const std::string& base)
     {
-        auto factors = getFactors(_number);
-        // Reverse the factors
-        std::ranges::reverse(factors);
-        // Get the largest root factor
-        for (const auto& factor : factors)
-        {
-            auto rootResult = isRoot(factor, base);
-            if (rootResult.getStatus() == StatusBool::CALCULATED_SIMPLIFIED_YES)
-                return {
-                    { _number, base, rootResult.getOutput() }, { factor }, factor, StatusBool::CALCULATED_SIMPLIFIED_YES
-                };
-        }
-        // The number has no root factors
-        return { { _number, base }, { "1" }, { "1" }, StatusBool::CALCULATED_SIMPLIFIED_YES };
+        bignum::BigDecimal number;
+        bignum::BigDecimal parsedBase;
+        long long index = 0;
+        if (not bignum::parse(_number, number) or not bignum::parse(base, parsedBase) or
+            not bignum::toInteger(parsedBase, index) or index < 1)
+            return { { _number, base, "1" }, { "1" }, { "1" }, StatusBool::CALCULATED_SIMPLIFIED_YES };
+
+        // The largest root factor takes each prime p^e of the factorization to the largest multiple of the base
+        // within e.
+        auto root = bignum::fromInteger(1);
+        for (const auto& [prime, exponent] : bignum::factorize(number))
+            if (const auto multiplicity = exponent / static_cast<unsigned long long>(index); multiplicity != 0)
+                root = bignum::multiply(root, bignum::power(prime, multiplicity));
+        const auto factor = bignum::toString(bignum::power(root, static_cast<unsigned long long>(index)));
+        return { { _number, base, bignum::toString(root) }, { factor }, factor, StatusBool::CALCULATED_SIMPLIFIED_YES };
     }
 
     std::string getGreatestRootNum(const std::string& _number, const std::string& base)
     {
         auto integralPart = rootIntPart(_number, base);
-        return power(integralPart, base, 0);
+        return integerPower(integralPart, base);
     }
 
     bool isPrime(const std::string& _number)
     {
-        auto factors = getFactors(_number);
-        return factors.size() == 2; // Only 1 and the number itself are factors ==> prime!
+        bignum::BigDecimal number;
+        return bignum::parse(_number, number) and bignum::isPrime(number);
     }
 
     ResultBool<std::string> isRoot(const std::string& _number, const std::string& base)
     {
         auto iRoot = rootIntPart(_number, base);
-        auto rootNum = power(iRoot, base, 0);
-        if (compare(rootNum, _number, 0) == "2")
+        auto rootNum = integerPower(iRoot, base);
+        if (bignum::compare(rootNum, _number) == 0)
             return { { _number, base }, { iRoot }, { iRoot }, StatusBool::CALCULATED_SIMPLIFIED_YES };
         return { { _number, base }, { "1" }, { "1" }, StatusBool::CALCULATED_SIMPLIFIED_NO };
     }
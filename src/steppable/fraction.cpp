@@ -30,6 +30,7 @@
 
 #include "steppable/fraction.hpp"
 
+#include "bignum.hpp"
 #include "exceptions.hpp"
 #include "fn/calc.hpp"
 #include "steppable/number.hpp"
@@ -37,6 +38,7 @@
 #include "util.hpp"
 
 #include <string>
+#include <tuple>
 #include <utility>
 
 #ifdef WINDOWS
@@ -66,6 +68,84 @@ namespace steppable::prettyPrint::printers
 
 namespace steppable
 {
+    namespace bignum = steppable::__internals::bignum;
+
+    namespace
+    {
+        /**
+         * @struct Components
+         * @brief The top and bottom components of a fraction, parsed.
+         */
+        struct Components
+        {
+            bignum::BigDecimal top; ///< The top component.
+            bignum::BigDecimal bottom; ///< The bottom component.
+        };
+
+        Components parseComponents(const Fraction& fraction)
+        {
+            const auto& [top, bottom] = fraction.asArray();
+            Components components;
+            bignum::parse(top, components.top);
+            bignum::parse(bottom, components.bottom);
+            return components;
+        }
+
+        bignum::BigDecimal divideExact(const bignum::BigDecimal& a, const bignum::BigDecimal& b)
+        {
+            return bignum::divideTruncated(a, b, 0);
+        }
+
+        /**
+         * @brief Adds a / b and c / d, where both are in lowest terms.
+         * @details With g = gcd(b, d), the sum is (a (d / g) + c (b / g)) / (b d / g). Only a factor of g can be left
+         * in common, so the final GCD is taken with g instead of the much larger denominator.
+         */
+        Components addComponents(const bignum::BigDecimal& a,
+                                 const bignum::BigDecimal& b,
+                                 const bignum::BigDecimal& c,
+                                 const bignum::BigDecimal& d)
+        {
+            const auto g = bignum::gcd(b, d);
+            const auto dOverG = divideExact(d, g);
+            const auto newTop = bignum::add(bignum::multiply(a, dOverG), bignum::multiply(c, divideExact(b, g)));
+            const auto newBottom = bignum::multiply(b, dOverG);
+            const auto common = bignum::gcd(newTop, g);
+            return { .top = divideExact(newTop, common), .bottom = divideExact(newBottom, common) };
+        }
+
+        /**
+         * @brief Multiplies a / b and c / d, where both are in lowest terms.
+         * @details The cross GCDs gcd(a, d) and gcd(c, b) are divided out before multiplying, which leaves the product
+         * in lowest terms and keeps the factors small.
+         */
+        Components multiplyComponents(const bignum::BigDecimal& a,
+                                      const bignum::BigDecimal& b,
+                                      const bignum::BigDecimal& c,
+                                      const bignum::BigDecimal& d)
+        {
+            const auto ad = bignum::gcd(a, d);
+            const auto cb = bignum::gcd(c, b);
+            return { .top = bignum::multiply(divideExact(a, ad), divideExact(c, cb)),
+                     .bottom = bignum::multiply(divideExact(b, cb), divideExact(d, ad)) };
+        }
+
+        /**
+         * @brief Converts the components back to strings, with the sign on the top component.
+         */
+        std::pair<std::string, std::string> toStrings(Components components)
+        {
+            if (components.top.isZero())
+                return { "0", "1" };
+            if (components.bottom.negative)
+            {
+                components.top.negative = not components.top.negative;
+                components.bottom.negative = false;
+            }
+            return { bignum::toString(components.top), bignum::toString(components.bottom) };
+        }
+    } // namespace
+
     Fraction::Fraction() : top("1"), bottom("1") {}
 
     Fraction::Fraction(const std::string& top, const std::string& bottom)
@@ -93,46 +173,56 @@ namespace steppable
 
     Fraction Fraction::operator+(const Fraction& rhs) const
     {
-        auto newTop = add(multiply(top, rhs.bottom, 0), multiply(rhs.top, bottom, 0), 0);
-        auto newBottom = multiply(bottom, rhs.bottom, 0);
-
-        auto newFrac = Fraction(newTop, newBottom);
-        newFrac.simplify();
+        auto newFrac = *this;
+        newFrac += rhs;
         return newFrac;
     }
 
     Fraction Fraction::operator-(const Fraction& rhs) const
     {
-        auto newTop = subtract(multiply(top, rhs.bottom, 0), multiply(rhs.top, bottom, 0), 0);
-        auto newBottom = multiply(bottom, rhs.bottom, 0);
-
-        auto newFrac = Fraction(newTop, newBottom);
-        newFrac.simplify();
+        auto newFrac = *this;
+        newFrac -= rhs;
         return newFrac;
     }
 
     Fraction Fraction::operator*(const Fraction& rhs) const
     {
-        auto newTop = multiply(top, rhs.top, 0);
-        auto newBottom = multiply(bottom, rhs.bottom, 0);
-
-        auto newFrac = Fraction(newTop, newBottom);
-        newFrac.simplify();
+        auto newFrac = *this;
+        newFrac *= rhs;
         return newFrac;
     }
 
     Fraction Fraction::operator/(const Fraction& rhs) const
     {
-        auto newTop = multiply(top, rhs.bottom, 0);
-        auto newBottom = multiply(bottom, rhs.top, 0);
-
-        auto newFrac = Fraction(newTop, newBottom);
-        newFrac.simplify();
+        auto newFrac = *this;
+        newFrac /= rhs;
         return newFrac;
     }
 
     Fraction Fraction::operator^(const Number& rhs)
     {
+        bignum::BigDecimal parsedTop;
+        bignum::BigDecimal parsedBottom;
+        bignum::BigDecimal parsedExponent;
+        if (long long exponent = 0; bignum::parse(rhs.present(), parsedExponent) and
+                                    bignum::toInteger(parsedExponent, exponent) and bignum::parse(top, parsedTop) and
+                                    bignum::parse(bottom, parsedBottom))
+        {
+            // (a / b)^-n = (b / a)^n
+            const auto magnitude = exponent >= 0 ? static_cast<unsigned long long>(exponent) :
+                                                   0ULL - static_cast<unsigned long long>(exponent);
+            auto newTop = bignum::power(parsedTop, magnitude);
+            auto newBottom = bignum::power(parsedBottom, magnitude);
+            if (exponent < 0)
+                std::swap(newTop, newBottom);
+            if (newBottom.negative)
+            {
+                newTop.negative = not newTop.negative and not newTop.isZero();
+                newBottom.negative = false;
+            }
+            return Fraction(bignum::toString(newTop), bignum::toString(newBottom));
+        }
+
         auto newTop = power(top, rhs.present(), 0);
         auto newBottom = power(bottom, rhs.present(), 0);
 
@@ -143,36 +233,43 @@ namespace steppable
 
     Fraction& Fraction::operator+=(const Fraction& rhs)
     {
-        *this = *this + rhs;
-        simplify();
+        const auto [a, b] = parseComponents(*this);
+        const auto [c, d] = parseComponents(rhs);
+        std::tie(top, bottom) = toStrings(addComponents(a, b, c, d));
         return *this;
     }
 
     Fraction& Fraction::operator-=(const Fraction& rhs)
     {
-        *this = *this - rhs;
-        simplify();
+        const auto [a, b] = parseComponents(*this);
+        auto [c, d] = parseComponents(rhs);
+        c.negative = not c.negative and not c.isZero();
+        std::tie(top, bottom) = toStrings(addComponents(a, b, c, d));
         return *this;
     }
 
     Fraction& Fraction::operator*=(const Fraction& rhs)
     {
-        *this = *this * rhs;
-        simplify();
+        const auto [a, b] = parseComponents(*this);
+        const auto [c, d] = parseComponents(rhs);
+        std::tie(top, bottom) = toStrings(multiplyComponents(a, b, c, d));
         return *this;
     }
 
     Fraction& Fraction::operator/=(const Fraction& rhs)
     {
-        *this = *this / rhs;
-        simplify();
+        const auto [a, b] = parseComponents(*this);
+        const auto [c, d] = parseComponents(rhs);
+        if (c.isZero())
+            throw exceptions::ZeroDenominatorException();
+        // (a / b) / (c / d) = (a / b) * (d / c)
+        std::tie(top, bottom) = toStrings(multiplyComponents(a, b, d, c));
         return *this;
     }
 
     Fraction& Fraction::operator^=(const Number& rhs)
     {
         *this = *this ^ rhs;
-        simplify();
         return *this;
     }
 
@@ -248,6 +345,17 @@ namespace steppable
 
     void Fraction::simplify()
     {
+        // Dividing by the GCD also clears the decimal points, since the GCD of two decimals divides both into integers.
+        bignum::BigDecimal parsedTop;
+        bignum::BigDecimal parsedBottom;
+        if (bignum::parse(top, parsedTop) and bignum::parse(bottom, parsedBottom) and not parsedBottom.isZero())
+        {
+            const auto gcd = bignum::gcd(parsedTop, parsedBottom);
+            std::tie(top, bottom) =
+                toStrings({ .top = divideExact(parsedTop, gcd), .bottom = divideExact(parsedBottom, gcd) });
+            return;
+        }
+
         // Make sure the fraction does not contain decimal points.
         top = standardizeNumber(top);
         bottom = standardizeNumber(bottom);
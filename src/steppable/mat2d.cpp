@@ -1,5 +1,5 @@
 /**************************************************************************************************
- * Copyright (c) 2023-2025 NWSOFT                                                                 *
+ * Copyright (c) 2023-2026 NWSOFT                                                                 *
  *                                                                                                *
  * Permission is hereby granted, free of charge, to any person obtaining a copy                   *
  * of this software and associated documentation files (the "Software"), to deal                  *
@@ -29,19 +29,28 @@
 
 #include "steppable/mat2d.hpp"
 
+#include "bignum.hpp"
 #include "getString.hpp"
 #include "output.hpp"
 #include "platform.hpp"
 #include "rounding.hpp"
 #include "steppable/number.hpp"
 #include "symbols.hpp"
+#include "threadPool.hpp"
 #include "util.hpp"
 
 #include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
 #include <iomanip>
 #include <iostream>
+#include <iterator>
+#include <span>
 #include <sstream>
 #include <string>
+#include <string_view>
+#include <utility>
 #include <vector>
 
 namespace steppable
@@ -50,9 +59,949 @@ namespace steppable
     using namespace __internals::numUtils;
     using namespace localization;
 
+    namespace
+    {
+        /**
+         * @brief The working copy of a matrix during elimination.
+         * @details Rows are swapped by swapping their indices in a row permutation, so that no elements are moved
+         * until the result is collected.
+         */
+        class EliminationBuffer
+        {
+            std::vector<Number> cells; ///< The elements of the matrix, in their original row order.
+            std::vector<size_t> order; ///< The row of `cells` that is currently at each position.
+            size_t cols; ///< The number of columns.
+
+        public:
+            /**
+             * @brief Copies the elements of a matrix.
+             *
+             * @param cells The elements of the matrix, stored row by row.
+             * @param rows The number of rows.
+             * @param cols The number of columns.
+             */
+            EliminationBuffer(std::vector<Number> cells, const size_t rows, const size_t cols) :
+                cells(std::move(cells)), order(rows), cols(cols)
+            {
+                for (size_t i = 0; i < rows; i++)
+                    order[i] = i;
+            }
+
+            /**
+             * @brief Gets the row at a position.
+             * @param y The position of the row.
+             * @return A pointer to the first element of the row. The elements of the row are contiguous.
+             */
+            Number* operator[](const size_t y) { return cells.data() + (order[y] * cols); }
+
+            /**
+             * @brief Swaps two rows.
+             *
+             * @param a The position of the first row.
+             * @param b The position of the second row.
+             */
+            void swapRows(const size_t a, const size_t b) { std::swap(order[a], order[b]); }
+
+            /**
+             * @brief Collects the elements in their current row order.
+             * @return The elements, stored row by row.
+             */
+            std::vector<Number> release()
+            {
+                std::vector<Number> result;
+                result.reserve(cells.size());
+                for (const size_t y : order)
+                    std::move(cells.begin() + static_cast<std::ptrdiff_t>(y * cols),
+                              cells.begin() + static_cast<std::ptrdiff_t>((y + 1) * cols),
+                              std::back_inserter(result));
+                return result;
+            }
+        };
+
+        /// @brief Products whose dimensions are all at least this large are split with the Strassen-Winograd scheme.
+        constexpr size_t WINOGRAD_THRESHOLD = 64;
+
+        /// @brief Strassen-Winograd only pays off when multiplying entries costs much more than adding them, i.e., when
+        /// the entries have at least this many limbs on average.
+        constexpr size_t WINOGRAD_MIN_LIMBS = 4;
+
+        /// @brief The number of rows and columns of an output tile, which is the unit of work handed to the pool.
+        constexpr size_t TILE_SIZE = 16;
+
+        /**
+         * @brief A matrix of exact decimals, stored row by row. Operands of a product are packed into panels once, so
+         * that the inner loops do not convert between representations.
+         */
+        struct Panel
+        {
+            size_t rows = 0; ///< The number of rows.
+            size_t cols = 0; ///< The number of columns.
+            long long exponent = 0; ///< The exponent shared by all non-zero elements.
+            std::vector<bignum::BigDecimal> cells; ///< The elements, stored row by row.
+
+            Panel(const size_t rows, const size_t cols) : rows(rows), cols(cols), cells(rows * cols) {}
+
+            bignum::BigDecimal& operator()(const size_t y, const size_t x) { return cells[(y * cols) + x]; }
+
+            const bignum::BigDecimal& operator()(const size_t y, const size_t x) const
+            {
+                return cells[(y * cols) + x];
+            }
+        };
+
+        /**
+         * @brief Rescales all non-zero elements of a panel to the smallest exponent among them.
+         * @param panel The panel.
+         */
+        void alignExponents(Panel& panel)
+        {
+            bool found = false;
+            for (const auto& value : panel.cells)
+                if (not value.isZero())
+                {
+                    panel.exponent = found ? std::min(panel.exponent, value.exponent) : value.exponent;
+                    found = true;
+                }
+            for (auto& value : panel.cells)
+                if (not value.isZero())
+                    bignum::rescale(value, panel.exponent);
+        }
+
+        /**
+         * @brief Converts matrix elements to exact decimals.
+         *
+         * @param[in] view The matrix elements.
+         * @param[out] values The decimals, stored row by row. It must have as many elements as the matrix.
+         * @return False if an element is not a number, such as "Infinity".
+         */
+        bool parseValues(const MatrixView<const Number>& view, const std::span<bignum::BigDecimal> values)
+        {
+            for (size_t i = 0; i < view.getRows(); i++)
+                for (size_t j = 0; j < view.getCols(); j++)
+                {
+                    auto& value = values[(i * view.getCols()) + j];
+                    if (not bignum::parse(view[{ .y = i, .x = j }].present(), value))
+                        return false;
+                    bignum::stripTrailingZeros(value);
+                }
+            return true;
+        }
+
+        /**
+         * @brief Packs matrix elements into a panel.
+         *
+         * @param[in] view The matrix elements.
+         * @param[out] panel The panel to fill. It must have the same dimensions as the matrix.
+         * @return False if an element is not a number, such as "Infinity".
+         */
+        bool pack(const MatrixView<const Number>& view, Panel& panel)
+        {
+            if (not parseValues(view, panel.cells))
+                return false;
+            alignExponents(panel);
+            return true;
+        }
+
+        /**
+         * @class DotAccumulator
+         * @brief Sums products of integers exactly, propagating carries only once for the whole sum.
+         * @details Each column holds a sum of limb products, which are below 10^18 each, so a 128-bit column cannot
+         * overflow. Positive and negative terms are summed apart and subtracted at the end.
+         */
+        class DotAccumulator
+        {
+            std::vector<unsigned __int128> positive; ///< Column sums of the positive terms.
+            std::vector<unsigned __int128> negative; ///< Column sums of the negative terms.
+
+            /**
+             * @brief Propagates the carries of a set of column sums.
+             * @param columns The column sums.
+             * @return The sum as limbs.
+             */
+            static bignum::Limbs normalize(const std::vector<unsigned __int128>& columns)
+            {
+                bignum::Limbs result;
+                result.reserve(columns.size() + 2);
+                unsigned __int128 carry = 0;
+                for (const auto column : columns)
+                {
+                    carry += column;
+                    result.push_back(static_cast<bignum::Limb>(carry % bignum::LIMB_BASE));
+                    carry /= bignum::LIMB_BASE;
+                }
+                for (; carry != 0; carry /= bignum::LIMB_BASE)
+                    result.push_back(static_cast<bignum::Limb>(carry % bignum::LIMB_BASE));
+                bignum::trim(result);
+                return result;
+            }
+
+        public:
+            /**
+             * @brief Adds the product of two integers to the sum.
+             *
+             * @param x The limbs of the first factor.
+             * @param xSize The number of limbs of the first factor.
+             * @param y The limbs of the second factor.
+             * @param ySize The number of limbs of the second factor.
+             * @param isNegative Whether the product is negative.
+             */
+            void add(const bignum::Limb* x,
+                     const size_t xSize,
+                     const bignum::Limb* y,
+                     const size_t ySize,
+                     const bool isNegative)
+            {
+                if (xSize == 0 or ySize == 0)
+                    return;
+                auto& columns = isNegative ? negative : positive;
+                if (columns.size() < xSize + ySize)
+                    columns.resize(xSize + ySize);
+
+                if (std::min(xSize, ySize) >= bignum::multiplyThresholds().karatsuba)
+                {
+                    const auto product = bignum::multiplyMagnitude({ x, x + xSize }, { y, y + ySize });
+                    for (size_t i = 0; i < product.size(); i++)
+                        columns[i] += product[i];
+                    return;
+                }
+                for (size_t i = 0; i < xSize; i++)
+                {
+                    const std::uint64_t limb = x[i];
+                    auto* column = columns.data() + i;
+                    for (size_t j = 0; j < ySize; j++)
+                        column[j] += limb * y[j];
+                }
+            }
+
+            /**
+             * @brief Gets the sum, and clears the accumulator for the next one.
+             * @param exponent The exponent of every product that was added.
+             * @return The exact sum.
+             */
+            bignum::BigDecimal take(const long long exponent)
+            {
+                const auto sum = normalize(positive);
+                const auto difference = normalize(negative);
+                positive.assign(positive.size(), 0);
+                negative.assign(negative.size(), 0);
+
+                bignum::BigDecimal result{ .exponent = exponent };
+                if (bignum::compareMagnitude(sum, difference) >= 0)
+                    result.mantissa = bignum::subtractMagnitude(sum, difference);
+                else
+                {
+                    result.mantissa = bignum::subtractMagnitude(difference, sum);
+                    result.negative = true;
+                }
+                if (result.isZero())
+                    result = {};
+                return result;
+            }
+        };
+
+        /**
+         * @brief The elements of a panel with their limbs stored one after another, so that a dot product reads memory
+         * in order.
+         */
+        struct PackedRows
+        {
+            /**
+             * @brief The position of an element in the limb buffer.
+             */
+            struct Entry
+            {
+                size_t offset = 0; ///< The index of the first limb.
+                size_t size = 0; ///< The number of limbs.
+                bool negative = false; ///< Whether the element is negative.
+            };
+
+            std::vector<bignum::Limb> limbs; ///< The limbs of all elements.
+            std::vector<Entry> entries; ///< The elements, stored row by row.
+
+            /**
+             * @brief Packs the rows, or the columns, of a panel, replacing the previous contents. The buffers keep
+             * their capacity, so that packing panels of the same size again does not allocate.
+             *
+             * @param panel The panel.
+             * @param transpose Whether to pack the columns of the panel as rows.
+             */
+            void assign(const Panel& panel, const bool transpose)
+            {
+                const size_t rows = transpose ? panel.cols : panel.rows;
+                const size_t cols = transpose ? panel.rows : panel.cols;
+                limbs.clear();
+                entries.clear();
+                entries.reserve(panel.cells.size());
+                for (size_t i = 0; i < rows; i++)
+                    for (size_t j = 0; j < cols; j++)
+                    {
+                        const auto& value = transpose ? panel(j, i) : panel(i, j);
+                        entries.push_back({ .offset = limbs.size(),
+                                            .size = value.mantissa.size(),
+                                            .negative = value.negative });
+                        limbs.insert(limbs.end(), value.mantissa.begin(), value.mantissa.end());
+                    }
+            }
+        };
+
+        /**
+         * @brief The packed operands of multiplyTiled(), kept between products of the same size.
+         */
+        struct TiledScratch
+        {
+            PackedRows aRows; ///< The rows of the left operand.
+            PackedRows bCols; ///< The columns of the right operand.
+        };
+
+        /**
+         * @brief Multiplies two panels tile by tile. The tiles of the result are calculated on the thread pool.
+         * @details Both operands are packed first, the right one by columns, so that each dot product reads two
+         * contiguous buffers. Every dot product is accumulated exactly. The pool hands the tiles out one at a time from
+         * a single shared queue, without work stealing. The tiles are about equal in size, so idle threads simply take
+         * the next one, which balances the load as well as stealing would.
+         *
+         * @param[in] a The left operand.
+         * @param[in] b The right operand.
+         * @param[out] c The exact product. It must not be one of the operands.
+         * @param scratch The buffers to pack the operands into.
+         */
+        void multiplyTiled(const Panel& a, const Panel& b, Panel& c, TiledScratch& scratch)
+        {
+            auto& [aRows, bCols] = scratch;
+            aRows.assign(a, false);
+            bCols.assign(b, true);
+            const size_t depth = a.cols;
+
+            c.rows = a.rows;
+            c.cols = b.cols;
+            c.cells.resize(a.rows * b.cols);
+            const size_t tileRows = (a.rows + TILE_SIZE - 1) / TILE_SIZE;
+            const size_t tileCols = (b.cols + TILE_SIZE - 1) / TILE_SIZE;
+            utils::ThreadPool::instance().run(tileRows * tileCols, [&](const size_t tile) {
+                const size_t rowStart = (tile / tileCols) * TILE_SIZE;
+                const size_t colStart = (tile % tileCols) * TILE_SIZE;
+                const size_t rowEnd = std::min(rowStart + TILE_SIZE, a.rows);
+                const size_t colEnd = std::min(colStart + TILE_SIZE, b.cols);
+                DotAccumulator sum;
+                for (size_t i = rowStart; i < rowEnd; i++)
+                    for (size_t j = colStart; j < colEnd; j++)
+                    {
+                        const auto* x = &aRows.entries[i * depth];
+                        const auto* y = &bCols.entries[j * depth];
+                        for (size_t k = 0; k < depth; k++)
+                            sum.add(aRows.limbs.data() + x[k].offset,
+                                    x[k].size,
+                                    bCols.limbs.data() + y[k].offset,
+                                    y[k].size,
+                                    x[k].negative != y[k].negative);
+                        c(i, j) = sum.take(a.exponent + b.exponent);
+                    }
+            });
+            alignExponents(c);
+        }
+
+        /**
+         * @brief Multiplies two panels tile by tile.
+         *
+         * @param a The left operand.
+         * @param b The right operand.
+         * @return The exact product.
+         */
+        Panel multiplyTiled(const Panel& a, const Panel& b)
+        {
+            Panel c(a.rows, b.cols);
+            TiledScratch scratch;
+            multiplyTiled(a, b, c, scratch);
+            return c;
+        }
+
+        /**
+         * @brief Gets a quadrant of a panel. Rows and columns beyond the panel are zero.
+         *
+         * @param panel The panel.
+         * @param y The first row of the quadrant.
+         * @param x The first column of the quadrant.
+         * @param rows The number of rows of the quadrant.
+         * @param cols The number of columns of the quadrant.
+         * @return The quadrant.
+         */
+        Panel quadrant(const Panel& panel, const size_t y, const size_t x, const size_t rows, const size_t cols)
+        {
+            Panel result(rows, cols);
+            for (size_t i = y; i < std::min(y + rows, panel.rows); i++)
+                for (size_t j = x; j < std::min(x + cols, panel.cols); j++)
+                    result(i - y, j - x) = panel(i, j);
+            alignExponents(result);
+            return result;
+        }
+
+        /**
+         * @brief Adds or subtracts two panels of the same dimensions.
+         *
+         * @param a The first panel.
+         * @param b The second panel.
+         * @param subtract Whether to subtract `b` instead of adding it.
+         * @return The sum or the difference.
+         */
+        Panel combine(const Panel& a, const Panel& b, const bool subtract)
+        {
+            Panel result(a.rows, a.cols);
+            for (size_t i = 0; i < a.cells.size(); i++)
+                result.cells[i] =
+                    subtract ? bignum::subtract(a.cells[i], b.cells[i]) : bignum::add(a.cells[i], b.cells[i]);
+            alignExponents(result);
+            return result;
+        }
+
+        /**
+         * @brief Multiplies two panels, splitting large products with the Strassen-Winograd scheme.
+         * @details Each split replaces one of eight half-size products with 15 additions. The additions are exact, so
+         * the result is the same as that of multiplyTiled(). Odd dimensions are padded with zeros.
+         *
+         * @param a The left operand.
+         * @param b The right operand.
+         * @return The exact product.
+         */
+        // NOLINTNEXTLINE(*-no-recursion)
+        Panel multiplyPanels(const Panel& a, const Panel& b)
+        {
+            if (std::min({ a.rows, a.cols, b.cols }) < WINOGRAD_THRESHOLD)
+                return multiplyTiled(a, b);
+
+            const size_t m = (a.rows + 1) / 2;
+            const size_t k = (a.cols + 1) / 2;
+            const size_t n = (b.cols + 1) / 2;
+            const auto a11 = quadrant(a, 0, 0, m, k);
+            const auto a12 = quadrant(a, 0, k, m, k);
+            const auto a21 = quadrant(a, m, 0, m, k);
+            const auto a22 = quadrant(a, m, k, m, k);
+            const auto b11 = quadrant(b, 0, 0, k, n);
+            const auto b12 = quadrant(b, 0, n, k, n);
+            const auto b21 = quadrant(b, k, 0, k, n);
+            const auto b22 = quadrant(b, k, n, k, n);
+
+            const auto s1 = combine(a21, a22, false);
+            const auto s2 = combine(s1, a11, true);
+            const auto s3 = combine(a11, a21, true);
+            const auto s4 = combine(a12, s2, true);
+            const auto t1 = combine(b12, b11, true);
+            const auto t2 = combine(b22, t1, true);
+            const auto t3 = combine(b22, b12, true);
+            const auto t4 = combine(t2, b21, true);
+
+            const auto p1 = multiplyPanels(a11, b11);
+            const auto u2 = combine(p1, multiplyPanels(s2, t2), false);
+            const auto u3 = combine(u2, multiplyPanels(s3, t3), false);
+            const auto p5 = multiplyPanels(s1, t1);
+            const auto u4 = combine(u2, p5, false);
+            const auto c11 = combine(p1, multiplyPanels(a12, b21), false);
+            const auto c12 = combine(u4, multiplyPanels(s4, b22), false);
+            const auto c21 = combine(u3, multiplyPanels(a22, t4), true);
+            const auto c22 = combine(u3, p5, false);
+
+            Panel c(a.rows, b.cols);
+            for (size_t i = 0; i < c.rows; i++)
+                for (size_t j = 0; j < c.cols; j++)
+                {
+                    const auto& quarter = i < m ? (j < n ? c11 : c12) : (j < n ? c21 : c22);
+                    c(i, j) = quarter(i % m, j % n);
+                }
+            return c;
+        }
+
+        /**
+         * @brief Checks whether the entries of two panels are large enough for Strassen-Winograd to pay off.
+         *
+         * @param a The first panel.
+         * @param b The second panel.
+         * @return True if the entries have at least WINOGRAD_MIN_LIMBS limbs on average.
+         */
+        bool worthSplitting(const Panel& a, const Panel& b)
+        {
+            size_t limbs = 0;
+            for (const auto& value : a.cells)
+                limbs += value.mantissa.size();
+            for (const auto& value : b.cells)
+                limbs += value.mantissa.size();
+            return limbs >= WINOGRAD_MIN_LIMBS * (a.cells.size() + b.cells.size());
+        }
+
+        /**
+         * @brief Rounds all elements of a panel to a number of decimal places.
+         *
+         * @param panel The panel.
+         * @param decimals The number of decimal places.
+         */
+        void roundOff(Panel& panel, const long long decimals)
+        {
+            for (auto& value : panel.cells)
+            {
+                value = bignum::roundOff(value, decimals);
+                bignum::stripTrailingZeros(value);
+            }
+            alignExponents(panel);
+        }
+
+        /**
+         * @brief Converts exact decimals to numbers.
+         *
+         * @param cells The decimals.
+         * @param decimals The number of decimal places to round the decimals to.
+         * @return The numbers.
+         */
+        std::vector<Number> unpack(const std::span<const bignum::BigDecimal> cells, const long long decimals)
+        {
+            std::vector<Number> values(cells.size());
+            for (size_t i = 0; i < cells.size(); i++)
+            {
+                auto rounded = bignum::roundOff(cells[i], decimals);
+                bignum::stripTrailingZeros(rounded);
+                values[i].set(bignum::toString(rounded));
+            }
+            return values;
+        }
+
+        /**
+         * @brief Raises a square panel to a positive integer power by repeated squaring.
+         * @details The bits of the exponent are read from the highest one, squaring the result for each bit and
+         * multiplying it by the base for each set bit. This takes at most 2 log2(n) products. Every product is rounded,
+         * as a product of two matrices is, and is calculated into the same buffers as the one before it.
+         *
+         * @param base The base. Its elements are exact.
+         * @param bits The binary digits of the exponent, starting with a 1.
+         * @param decimals The number of decimal places to round each product to.
+         * @return The power.
+         */
+        Panel power(const Panel& base, const std::string_view bits, const long long decimals)
+        {
+            const bool split = worthSplitting(base, base);
+            auto result = base;
+            Panel product(base.rows, base.cols);
+            TiledScratch scratch;
+            const auto multiplyInto = [&](const Panel& rhs) {
+                if (split)
+                    product = multiplyPanels(result, rhs);
+                else
+                    multiplyTiled(result, rhs, product, scratch);
+                roundOff(product, decimals);
+                std::swap(result, product);
+            };
+
+            for (const char bit : bits.substr(1))
+            {
+                multiplyInto(result);
+                if (bit == '1')
+                    multiplyInto(base);
+            }
+            return result;
+        }
+
+        /// @brief Extra decimal places that the factors of an LU decomposition are kept to, so that the results
+        /// calculated from them can be rounded correctly.
+        constexpr long long LU_GUARD_DIGITS = 10;
+
+        /**
+         * @brief Checks whether the magnitude of a decimal is larger than that of another.
+         *
+         * @param a The first decimal.
+         * @param b The second decimal.
+         * @return True if |a| > |b|.
+         */
+        bool largerMagnitude(bignum::BigDecimal a, bignum::BigDecimal b)
+        {
+            a.negative = false;
+            b.negative = false;
+            return bignum::compare(a, b) > 0;
+        }
+
+        /**
+         * @brief Converts matrix elements to exact decimals, if they should be eliminated exactly.
+         *
+         * @param[in] view The matrix elements.
+         * @param[in] mode How the elements should be kept during elimination.
+         * @param[out] values The decimals, stored row by row. It must have as many elements as the matrix.
+         * @return True if the elements are to be eliminated exactly.
+         */
+        bool exactValues(const MatrixView<const Number>& view,
+                         const EliminationMode mode,
+                         const std::span<bignum::BigDecimal> values)
+        {
+            if (mode == EliminationMode::ROUNDED or not parseValues(view, values))
+                return false;
+            return mode == EliminationMode::EXACT or
+                   std::ranges::all_of(values, [](const auto& value) { return value.isInteger(); });
+        }
+
+        /**
+         * @brief Scales each row of a matrix by a power of ten, so that all of its elements become integers.
+         *
+         * @param cells The elements, stored row by row. All of them have the exponent zero afterwards.
+         * @param rows The number of rows.
+         * @param cols The number of columns.
+         * @return The sum of the exponents of the rows, so that det(before) = det(after) * 10^sum.
+         */
+        long long scaleToIntegers(std::vector<bignum::BigDecimal>& cells, const size_t rows, const size_t cols)
+        {
+            long long sum = 0;
+            for (size_t i = 0; i < rows; i++)
+            {
+                const std::span row(cells.data() + (i * cols), cols);
+                long long exponent = 0;
+                bool found = false;
+                for (const auto& value : row)
+                    if (not value.isZero())
+                    {
+                        exponent = found ? std::min(exponent, value.exponent) : value.exponent;
+                        found = true;
+                    }
+                for (auto& value : row)
+                {
+                    if (not value.isZero())
+                        bignum::rescale(value, exponent);
+                    value.exponent = 0;
+                }
+                sum += exponent;
+            }
+            return sum;
+        }
+
+        /**
+         * @brief Divides two integers that are known to divide exactly.
+         *
+         * @details A remainder means the elimination is broken, so it is reported and the program exits.
+         *
+         * @param a The dividend.
+         * @param b The divisor, which must not be zero.
+         * @return The quotient.
+         */
+        bignum::BigDecimal divideExact(const bignum::BigDecimal& a, const bignum::BigDecimal& b)
+        {
+            auto [quotient, remainder] = bignum::divideMagnitude(a.mantissa, b.mantissa);
+            if (not remainder.empty())
+            {
+                output::error("Matrix::divideExact"s, "Exact division left a remainder."s);
+                utils::programSafeExit(1);
+            }
+            bignum::BigDecimal result{ .mantissa = std::move(quotient) };
+            result.negative = (a.negative != b.negative) and not result.isZero();
+            return result;
+        }
+
+        /**
+         * @brief The pivots of a fraction-free elimination.
+         */
+        struct FractionFreeResult
+        {
+            std::vector<size_t> pivots; ///< The column of the pivot in each row. Its size is the rank.
+            bool oddPermutation = false; ///< Whether an odd number of rows were swapped.
+        };
+
+        /**
+         * @brief Eliminates a matrix of integers without fractions (Bareiss).
+         * @details Each step replaces a_ij with (p a_ij - a_ik a_kj) / q, where p is the pivot and q the pivot of the
+         * step before. The division is always exact, and the elements stay minors of the matrix, so they only grow
+         * linearly in length. After the elimination, the last element of a square matrix is its determinant, up to
+         * the sign of the row swaps. The rows below each pivot are updated on the thread pool.
+         *
+         * @param cells The integers, stored row by row. Eliminated in place.
+         * @param rows The number of rows.
+         * @param cols The number of columns.
+         * @param reduce Whether to eliminate above the pivots too. Each row is then its pivot times the row of the
+         * reduced row echelon form.
+         * @return The pivots.
+         */
+        FractionFreeResult eliminateFractionFree(std::vector<bignum::BigDecimal>& cells,
+                                                 const size_t rows,
+                                                 const size_t cols,
+                                                 const bool reduce)
+        {
+            FractionFreeResult result;
+            auto previous = bignum::fromInteger(1);
+            for (size_t col = 0; col < cols and result.pivots.size() < rows; col++)
+            {
+                const size_t row = result.pivots.size();
+                size_t pivot = row;
+                while (pivot < rows and cells[(pivot * cols) + col].isZero())
+                    pivot++;
+                if (pivot == rows)
+                    continue; // All zeros in this column
+
+                if (pivot != row)
+                {
+                    const auto pivotFirst = cells.begin() + static_cast<std::ptrdiff_t>(pivot * cols);
+                    std::swap_ranges(pivotFirst,
+                                     pivotFirst + static_cast<std::ptrdiff_t>(cols),
+                                     cells.begin() + static_cast<std::ptrdiff_t>(row * cols));
+                    result.oddPermutation = not result.oddPermutation;
+                }
+
+                const auto* pivotRow = cells.data() + (row * cols);
+                const size_t first = reduce ? 0 : row + 1;
+                utils::ThreadPool::instance().run(rows - first, [&](const size_t task) {
+                    const size_t i = first + task;
+                    if (i == row)
+                        return;
+                    auto* current = cells.data() + (i * cols);
+                    const auto factor = current[col];
+                    // Below the pivot, the columns before it are already zero.
+                    for (size_t j = reduce ? 0 : col + 1; j < cols; j++)
+                    {
+                        if (j == col or (current[j].isZero() and (factor.isZero() or pivotRow[j].isZero())))
+                            continue;
+                        auto value = bignum::multiply(pivotRow[col], current[j]);
+                        if (not factor.isZero() and not pivotRow[j].isZero())
+                            value = bignum::subtract(value, bignum::multiply(factor, pivotRow[j]));
+                        current[j] = divideExact(value, previous);
+                    }
+                    current[col] = {};
+                });
+                previous = pivotRow[col];
+                result.pivots.push_back(col);
+            }
+            return result;
+        }
+
+        /// @brief Integer matrices with at least this many rows and columns are eliminated modulo primes instead of
+        /// with Bareiss.
+        constexpr size_t MODULAR_MIN_SIZE = 8;
+
+        /// @brief Every prime for multi-modular elimination carries at least this many bits of the result.
+        constexpr double MODULAR_BITS_PER_PRIME = bignum::MODULAR_PRIME_BITS - 1;
+
+        /**
+         * @brief Multiplies numbers by a fixed factor modulo a prime, with Shoup's method.
+         * @details The quotient floor(factor * 2^64 / p) is calculated once, so that each product takes two native
+         * multiplications and no division.
+         */
+        class ModularFactor
+        {
+            std::uint64_t value; ///< The factor, less than the prime.
+            std::uint64_t quotient; ///< floor(value * 2^64 / p).
+
+        public:
+            /**
+             * @brief Prepares a factor.
+             *
+             * @param value The factor, less than the prime.
+             * @param p The prime.
+             */
+            ModularFactor(const std::uint64_t value, const std::uint64_t p) :
+                value(value), quotient(static_cast<std::uint64_t>((static_cast<unsigned __int128>(value) << 64) / p))
+            {
+            }
+
+            /**
+             * @brief Multiplies a residue by the factor.
+             *
+             * @param x The residue, less than the prime.
+             * @param p The prime.
+             * @return (value * x) mod p.
+             */
+            [[nodiscard]] std::uint64_t times(const std::uint64_t x, const std::uint64_t p) const
+            {
+                const auto estimate = static_cast<std::uint64_t>((static_cast<unsigned __int128>(quotient) * x) >> 64);
+                const std::uint64_t result = (value * x) - (estimate * p);
+                return result >= p ? result - p : result;
+            }
+        };
+
+        /**
+         * @brief Calculates the inverse of a residue modulo a prime, with Fermat's little theorem.
+         *
+         * @param x The residue, not zero.
+         * @param p The prime.
+         * @return x^-1 mod p.
+         */
+        std::uint64_t inverseModulo(std::uint64_t x, const std::uint64_t p)
+        {
+            std::uint64_t result = 1;
+            for (std::uint64_t exponent = p - 2; exponent != 0; exponent /= 2)
+            {
+                if (exponent % 2 == 1)
+                    result = static_cast<std::uint64_t>((static_cast<unsigned __int128>(result) * x) % p);
+                x = static_cast<std::uint64_t>((static_cast<unsigned __int128>(x) * x) % p);
+            }
+            return result;
+        }
+
+        /**
+         * @brief The rank and determinant of an integer matrix modulo a prime.
+         */
+        struct ModularResult
+        {
+            size_t rank = 0; ///< The rank modulo the prime, which is at most the rank.
+            std::uint64_t det = 0; ///< The determinant modulo the prime, for square matrices.
+        };
+
+        /**
+         * @brief Eliminates an integer matrix modulo a prime, in native words.
+         *
+         * @param cells The integers, stored row by row.
+         * @param rows The number of rows.
+         * @param cols The number of columns.
+         * @param p The prime.
+         * @return The rank and determinant modulo the prime.
+         */
+        ModularResult eliminateModulo(const std::vector<bignum::BigDecimal>& cells,
+                                      const size_t rows,
+                                      const size_t cols,
+                                      const std::uint64_t p)
+        {
+            std::vector<std::uint64_t> residues(cells.size());
+            for (size_t i = 0; i < cells.size(); i++)
+            {
+                const auto residue = bignum::remainderWord(cells[i].mantissa, p);
+                residues[i] = cells[i].negative and residue != 0 ? p - residue : residue;
+            }
+
+            ModularResult result{ .det = 1 };
+            for (size_t col = 0; col < cols and result.rank < rows; col++)
+            {
+                const size_t row = result.rank;
+                size_t pivot = row;
+                while (pivot < rows and residues[(pivot * cols) + col] == 0)
+                    pivot++;
+                if (pivot == rows)
+                    continue; // All zeros in this column
+
+                auto* pivotRow = residues.data() + (row * cols);
+                if (pivot != row)
+                {
+                    std::swap_ranges(pivotRow, pivotRow + cols, residues.data() + (pivot * cols));
+                    result.det = p - result.det;
+                }
+                result.det = ModularFactor(result.det, p).times(pivotRow[col], p);
+
+                const auto inverse = inverseModulo(pivotRow[col], p);
+                for (size_t i = row + 1; i < rows; i++)
+                {
+                    auto* current = residues.data() + (i * cols);
+                    if (current[col] == 0)
+                        continue;
+                    // current -= factor * pivotRow, where factor = current[col] / pivot.
+                    const ModularFactor negativeFactor(p - ModularFactor(current[col], p).times(inverse, p), p);
+                    for (size_t j = col + 1; j < cols; j++)
+                    {
+                        const auto sum = current[j] + negativeFactor.times(pivotRow[j], p);
+                        current[j] = sum >= p ? sum - p : sum;
+                    }
+                    current[col] = 0;
+                }
+                result.rank++;
+            }
+            if (result.rank < rows)
+                result.det = 0;
+            return result;
+        }
+
+        /**
+         * @brief Finds an upper bound of the bits of any minor of an integer matrix, with Hadamard's inequality.
+         * @details A minor is at most the product of the lengths of its rows, each of which is at most the length of
+         * the row of the matrix it is taken from. Rows shorter than 1 are counted as 1.
+         *
+         * @param cells The integers, stored row by row.
+         * @param rows The number of rows.
+         * @param cols The number of columns.
+         * @return log2 of the bound.
+         */
+        double hadamardBits(const std::vector<bignum::BigDecimal>& cells, const size_t rows, const size_t cols)
+        {
+            const auto limbBits = std::log2(static_cast<double>(bignum::LIMB_BASE));
+            double bits = 0;
+            for (size_t i = 0; i < rows; i++)
+            {
+                // log2 of each element, from its two leading limbs. The bound is padded later for what is cut off.
+                std::vector<double> logs;
+                for (size_t j = 0; j < cols; j++)
+                    if (const auto& mantissa = cells[(i * cols) + j].mantissa; not mantissa.empty())
+                    {
+                        const size_t size = mantissa.size();
+                        auto leading = static_cast<double>(mantissa.back());
+                        if (size > 1)
+                            leading += static_cast<double>(mantissa[size - 2]) / static_cast<double>(bignum::LIMB_BASE);
+                        logs.push_back(std::log2(leading) + (static_cast<double>(size - 1) * limbBits));
+                    }
+                if (logs.empty())
+                    continue;
+
+                // log2(sqrt(sum of x^2)), scaled by the largest element so that nothing overflows.
+                const double largest = std::ranges::max(logs);
+                double sum = 0;
+                for (const double log : logs)
+                    sum += std::exp2(2 * (log - largest));
+                bits += std::max(0.0, largest + (std::log2(sum) / 2));
+            }
+            return bits;
+        }
+
+        /**
+         * @brief Eliminates an integer matrix modulo enough primes to find its rank and determinant exactly.
+         * @details The number of primes is chosen so that their product exceeds twice the Hadamard bound. The primes
+         * are independent, so each of them is eliminated as a task on the thread pool. A prime can only lose pivots,
+         * so the rank is the largest among the primes. If only the rank is needed, a full rank from the first prime is final.
+         *
+         * @param cells The integers, stored row by row.
+         * @param rows The number of rows.
+         * @param cols The number of columns.
+         * @param needDet Whether to find the determinant. The matrix must be square.
+         * @param[out] det The determinant, if it is needed.
+         * @return The rank.
+         */
+        size_t eliminateMultiModular(const std::vector<bignum::BigDecimal>& cells,
+                                     const size_t rows,
+                                     const size_t cols,
+                                     const bool needDet,
+                                     bignum::BigDecimal& det)
+        {
+            const auto count = static_cast<size_t>(std::ceil((hadamardBits(cells, rows, cols) + 2) /
+                                                             MODULAR_BITS_PER_PRIME));
+            const auto primes = bignum::modularPrimes(std::max<size_t>(count, 1));
+
+            // For the rank alone, one prime is enough if it finds no pivot missing.
+            const auto first = eliminateModulo(cells, rows, cols, primes.front());
+            if (not needDet and first.rank == std::min(rows, cols))
+                return first.rank;
+
+            std::vector<ModularResult> results(primes.size());
+            results.front() = first;
+            utils::ThreadPool::instance().run(primes.size() - 1, [&](const size_t task) {
+                results[task + 1] = eliminateModulo(cells, rows, cols, primes[task + 1]);
+            });
+
+            size_t rank = 0;
+            std::vector<std::uint64_t> residues;
+            residues.reserve(results.size());
+            for (const auto& result : results)
+            {
+                rank = std::max(rank, result.rank);
+                residues.push_back(result.det);
+            }
+            if (needDet)
+                det = bignum::chineseRemainder(residues, primes);
+            return rank;
+        }
+
+        /**
+         * @brief Finds the rank of a matrix of integers exactly.
+         * @details Matrices with at least MODULAR_MIN_SIZE rows and columns are eliminated modulo many primes, and
+         * smaller ones with Bareiss.
+         *
+         * @param cells The integers, stored row by row, with the exponent zero. They may be changed.
+         * @param rows The number of rows.
+         * @param cols The number of columns.
+         * @return The rank.
+         */
+        size_t exactRank(std::vector<bignum::BigDecimal>& cells, const size_t rows, const size_t cols)
+        {
+            if (bignum::BigDecimal det; std::min(rows, cols) >= MODULAR_MIN_SIZE)
+                return eliminateMultiModular(cells, rows, cols, false, det);
+            return eliminateFractionFree(cells, rows, cols, false).pivots.size();
+        }
+    } // namespace
+
     namespace prettyPrint::printers
     {
-        std::string ppMatrix(const MatVec2D<Number>& matrix, const int endRows)
+        std::string ppMatrix(const MatrixView<const Number>& matrix, const int endRows)
         {
             int maxLen = 0;
             std::stringstream ss;
@@ -65,10 +1014,10 @@ namespace steppable
                 }
             }
 
-            size_t matrixRows = matrix.size();
+            size_t matrixRows = matrix.getRows();
             for (size_t rowIdx = 0; rowIdx < matrixRows; rowIdx++)
             {
-                const auto& row = matrix[rowIdx];
+                const auto row = matrix.row(rowIdx);
                 if (matrixRows == 1)
                     ss << "[";
                 else if (rowIdx == 0)
@@ -100,36 +1049,42 @@ namespace steppable
         }
     } // namespace prettyPrint::printers
 
-    void Matrix::_checkDataSanity(const MatVec2D<Number>& data)
+    void Matrix::_checkRowSanity(const size_t rowSize, const size_t cols)
     {
-        size_t size = data.front().size();
-        for (const auto& row : data)
+        if (rowSize != cols)
         {
-            const size_t rowSize = row.size();
-            if (rowSize != size)
-            {
-                output::error("Matrix::_checkDataSanity"s, $("mat2d", "75953952-0eea-4716-a006-d0f2e7a8f6c9"));
-                utils::programSafeExit(1);
-            }
-            size = rowSize;
+            output::error("Matrix::_checkDataSanity"s, $("mat2d", "75953952-0eea-4716-a006-d0f2e7a8f6c9"));
+            utils::programSafeExit(1);
         }
     }
 
-    Matrix::Matrix() : data({ {} }) { _cols = _rows = 0; }
+    Matrix::Matrix() { _cols = _rows = 0; }
 
-    Matrix::Matrix(const size_t rows, const size_t cols, const Number& fill) :
-        data(std::vector(rows, std::vector(cols, fill))), _cols(cols), _rows(rows)
+    Matrix::Matrix(const size_t rows, const size_t cols, const Number& fill) : _cols(cols), _rows(rows)
     {
-        data = roundOffValues(data, static_cast<int>(prec));
-        _checkDataSanity(data);
+        std::vector rounded{ fill };
+        roundOffValues(rounded, prec);
+        data.assign(rows * cols, rounded.front());
     }
 
     Matrix::Matrix(const MatVec2D<Number>& data, const size_t prec) :
-        data(data), _cols(data.front().size()), _rows(data.size()), prec(prec)
+        _cols(data.front().size()), _rows(data.size()), prec(prec)
+    {
+        this->data.reserve(_rows * _cols);
+        for (const auto& row : data)
+        {
+            _checkRowSanity(row.size(), _cols);
+            this->data.insert(this->data.end(), row.begin(), row.end());
+        }
+        for (auto& value : this->data)
+            value.setPrec(prec + 3, RoundingMode::USE_MAXIMUM_PREC);
+    }
+
+    Matrix::Matrix(const size_t rows, const size_t cols, std::vector<Number> data, const size_t prec) :
+        _cols(cols), _rows(rows), prec(prec), data(std::move(data))
     {
-        for (auto& row : this->data)
-            for (auto& value : row)
-                value.setPrec(prec + 3, RoundingMode::USE_MAXIMUM_PREC);
+        for (auto& value : this->data)
+            value.setPrec(prec + 3, RoundingMode::USE_MAXIMUM_PREC);
     }
 
     void Matrix::_checkIdxSanity(const YXPoint* point) const
@@ -137,14 +1092,14 @@ namespace steppable
         const auto x = point->x;
         const auto y = point->y;
 
-        if (x > _cols)
+        if (x >= _cols)
         {
             output::error(
                 "Matrix::operator[]"s,
                 $("mat2d", "8d4e4757-415b-4aed-8f5e-26b3503a95dd"s, { std::to_string(x), std::to_string(_cols) }));
             utils::programSafeExit(1);
         }
-        if (y > _rows)
+        if (y >= _rows)
         {
             output::error(
                 "Matrix::operator[]"s,
@@ -153,69 +1108,93 @@ namespace steppable
         }
     }
 
-    MatVec2D<Number> Matrix::roundOffValues(const MatVec2D<Number>& _data, const size_t prec)
+    void Matrix::roundOffValues(const std::span<Number> data, const size_t prec)
     {
-        auto data = _data;
-        for (auto& row : data)
-            for (auto& val : row)
-            {
-                auto valueString = val.present();
+        for (auto& val : data)
+        {
+            auto valueString = val.present();
 
-                if (valueString == "Indeterminate")
-                    valueString = "0";
-                else
-                {
-                    valueString = roundOff(val.present(), prec);
-                    valueString = standardizeNumber(valueString);
-                }
-                val.set(valueString);
+            if (valueString == "Indeterminate")
+                valueString = "0";
+            else
+            {
+                valueString = roundOff(valueString, prec);
+                valueString = standardizeNumber(valueString);
             }
-        return data;
+            val.set(valueString);
+        }
     }
 
-    Matrix Matrix::roundOffValues(const size_t prec) const { return roundOffValues(data, prec); }
+    Matrix Matrix::roundOffValues(const size_t prec) const
+    {
+        auto matrix = *this;
+        roundOffValues(matrix.data, prec);
+        return matrix;
+    }
 
-    Matrix Matrix::rref() const
+    Matrix Matrix::rref(const EliminationMode mode) const
     {
+        if (std::vector<bignum::BigDecimal> values(data.size()); exactValues(getData(), mode, values))
+        {
+            // Scaling a row does not change the reduced row echelon form.
+            scaleToIntegers(values, _rows, _cols);
+            const auto [pivots, oddPermutation] = eliminateFractionFree(values, _rows, _cols, true);
+            std::vector<Number> matrix(data.size());
+            for (size_t i = 0; i < pivots.size(); i++)
+            {
+                const auto& pivot = values[(i * _cols) + pivots[i]];
+                for (size_t j = 0; j < _cols; j++)
+                {
+                    auto value = bignum::divideRounded(values[(i * _cols) + j], pivot, static_cast<long long>(prec));
+                    bignum::stripTrailingZeros(value);
+                    matrix[(i * _cols) + j].set(bignum::toString(value));
+                }
+            }
+            return { _rows, _cols, std::move(matrix), prec };
+        }
+
         // Adapted from https://stackoverflow.com/a/31761026/14868780
         auto matrix = data;
-        matrix = roundOffValues(matrix, static_cast<int>(prec));
+        roundOffValues(matrix, prec);
 #if defined(STP_DEB_MATRIX_REF_RESULT_INSPECT) && DEBUG
-        std::cout << prettyPrint::printers::ppMatrix(matrix, 1) << "\n";
+        std::cout << prettyPrint::printers::ppMatrix({ matrix.data(), _rows, _cols }, 1) << "\n";
 #endif
 
-        for (size_t lead = 0; lead < _rows; lead++)
+        // Rounding is idempotent, so only the row that has just been changed has to be rounded again.
+        for (size_t lead = 0; lead < std::min(_rows, _cols); lead++)
         {
+            Number* leadRow = matrix.data() + (lead * _cols);
             Number divisor("0", 30, RoundingMode::USE_MAXIMUM_PREC);
             Number multiplier("0", 30, RoundingMode::USE_MAXIMUM_PREC);
             for (size_t r = 0; r < _rows; r++)
             {
-                divisor = matrix[lead][lead];
-                multiplier = matrix[r][lead] / matrix[lead][lead];
+                Number* row = matrix.data() + (r * _cols);
+                divisor = leadRow[lead];
+                multiplier = row[lead] / leadRow[lead];
                 for (size_t c = 0; c < _cols; c++)
                     if (r == lead)
                     {
 #if defined(STP_DEB_CALC_DIVISION_RESULT_INSPECT) && DEBUG
-                        auto oldMatrixRC = matrix[r][c];
+                        auto oldMatrixRC = row[c];
 #endif
 
-                        matrix[r][c] /= divisor;
+                        row[c] /= divisor;
 
 #if defined(STP_DEB_CALC_DIVISION_RESULT_INSPECT) && DEBUG
                         output::info("Matrix::rref"s,
                                      oldMatrixRC.present() + " " + std::string(__internals::symbols::DIVIDED_BY) + " " +
-                                         divisor.present() + " = " + matrix[r][c].present());
+                                         divisor.present() + " = " + row[c].present());
 #endif
                     }
                     else
                     {
 #if defined(STP_DEB_MATRIX_REF_RESULT_INSPECT) && DEBUG
-                        auto oldMatrixRC = matrix[r][c];
-                        auto oldMatrixLeadC = matrix[lead][c];
+                        auto oldMatrixRC = row[c];
+                        auto oldMatrixLeadC = leadRow[c];
 #endif
 
-                        auto multiplyResult = matrix[lead][c] * multiplier;
-                        matrix[r][c] -= multiplyResult;
+                        auto multiplyResult = leadRow[c] * multiplier;
+                        row[c] -= multiplyResult;
 
 #if defined(STP_DEB_MATRIX_REF_RESULT_INSPECT) && DEBUG
                         output::info("Matrix::rref"s,
@@ -223,108 +1202,122 @@ namespace steppable
                                          std::string(__internals::symbols::MULTIPLY) + " " + multiplier.present());
                         output::info("Matrix::rref"s,
                                      "    = " + oldMatrixRC.present() + " - " + multiplyResult.present());
-                        output::info("Matrix::rref"s, "    = " + matrix[r][c].present());
+                        output::info("Matrix::rref"s, "    = " + row[c].present());
 #endif
                     }
 
-                matrix = roundOffValues(matrix, static_cast<int>(prec) + 3);
+                roundOffValues({ row, _cols }, prec + 3);
             }
 #if defined(STP_DEB_MATRIX_REF_RESULT_INSPECT) && DEBUG
-            std::cout << prettyPrint::printers::ppMatrix(matrix, 1) << "\n";
+            std::cout << prettyPrint::printers::ppMatrix({ matrix.data(), _rows, _cols }, 1) << "\n";
 #endif
         }
 
-        matrix = roundOffValues(matrix, static_cast<int>(prec));
-        return { matrix, prec };
+        roundOffValues(matrix, prec);
+        return { _rows, _cols, std::move(matrix), prec };
     }
 
     Matrix Matrix::ref() const
     {
-        MatVec2D<Number> mat = data;
-        mat = roundOffValues(mat, static_cast<int>(prec) + 3);
+        auto cells = data;
+        roundOffValues(cells, prec + 3);
+        EliminationBuffer mat(std::move(cells), _rows, _cols);
 
-        for (long long signed col = 0, row = 0; col < _cols && row < _rows; ++col)
+        for (size_t col = 0, row = 0; col < _cols && row < _rows; ++col)
         {
             // Find first non-zero in column col, at or below row
-            long long signed sel = -1;
-            for (long long signed i = row; i < _rows; ++i)
-                if (mat[i][col] != 0.0)
+            size_t sel = _rows;
+            for (size_t i = row; i < _rows; ++i)
+                if (mat[i][col] != 0)
                 {
                     sel = i;
                     break;
                 }
-            if (sel == -1)
+            if (sel == _rows)
                 continue; // All zeros in this column
 
             if (sel != row)
-                std::swap(mat[row], mat[sel]); // Swap if needed
+                mat.swapRows(row, sel); // Swap if needed
 
             // Eliminate below
-            for (long long signed i = row + 1; i < _rows; ++i)
+            const Number* pivotRow = mat[row];
+            for (size_t i = row + 1; i < _rows; ++i)
             {
-                Number factor = mat[i][col] / mat[row][col];
-                for (long long signed j = col; j < _cols; ++j)
-                    mat[i][j] -= factor * mat[row][j];
+                Number* current = mat[i];
+                Number factor = current[col] / pivotRow[col];
+                for (size_t j = col; j < _cols; ++j)
+                    current[j] -= factor * pivotRow[j];
             }
             ++row;
         }
-        mat = roundOffValues(mat, static_cast<int>(prec));
-        return { mat, prec };
+        auto result = mat.release();
+        roundOffValues(result, prec);
+        return { _rows, _cols, std::move(result), prec };
     }
 
-    Number Matrix::det() const
+    MatVec2D<Fraction> Matrix::rrefFractions() const
     {
-        if (_rows != _cols)
+        std::vector<bignum::BigDecimal> values(data.size());
+        if (not exactValues(getData(), EliminationMode::EXACT, values))
         {
-            output::error("Matrix::det"s, $("mat2d", "fe78bdc2-b409-4078-8e0e-313c46977f25"));
+            output::error("Matrix::rrefFractions"s, $("mat2d", "54945f22-010a-4ce0-94a3-f0c4d8d84d0b"));
             utils::programSafeExit(1);
         }
-        int sign = 1;
-        Number determinant = 1;
-        MatVec2D<Number> mat = data;
-        mat = roundOffValues(mat, static_cast<int>(prec) + 3);
+        scaleToIntegers(values, _rows, _cols);
+        const auto [pivots, oddPermutation] = eliminateFractionFree(values, _rows, _cols, true);
 
-        for (size_t col = 0, row = 0; col < _cols && row < _rows; ++col)
+        MatVec2D<Fraction> matrix(_rows, std::vector<Fraction>(_cols, Fraction("0"s, "1"s)));
+        for (size_t i = 0; i < pivots.size(); i++)
         {
-            // Find first non-zero in column col, at or below row
-            size_t sel = -1;
-            for (size_t i = row; i < _rows; ++i)
-                if (mat[i][col] != 0.0)
-                {
-                    sel = i;
-                    break;
-                }
-            if (sel == -1)
-                continue; // All zeros in this column
-
-            if (sel != row)
+            auto pivot = values[(i * _cols) + pivots[i]];
+            const bool negative = pivot.negative;
+            pivot.negative = false;
+            for (size_t j = 0; j < _cols; j++)
             {
-                // Swap rows - determinant becomes negative
-                sign = -sign;
-                std::swap(mat[row], mat[sel]);
+                auto value = values[(i * _cols) + j];
+                value.negative = (value.negative != negative) and not value.isZero();
+                matrix[i][j] = Fraction(bignum::toString(value), bignum::toString(pivot));
             }
+        }
+        return matrix;
+    }
 
-            // Eliminate below
-            for (size_t i = row + 1; i < _rows; ++i)
-            {
-                Number factor = mat[i][col] / mat[row][col];
-                for (size_t j = col; j < _cols; ++j)
-                    mat[i][j] -= factor * mat[row][j];
-            }
-            ++row;
+    Number Matrix::det(const EliminationMode mode) const
+    {
+        if (_rows != _cols)
+        {
+            output::error("Matrix::det"s, $("mat2d", "fe78bdc2-b409-4078-8e0e-313c46977f25"));
+            utils::programSafeExit(1);
         }
-        determinant *= sign;
-        mat = roundOffValues(mat, static_cast<int>(prec));
-        for (size_t i = 0; i < _cols; i++)
-            determinant *= mat[i][i];
-        return determinant;
+
+        std::vector<bignum::BigDecimal> values(data.size());
+        if (not exactValues(getData(), mode, values))
+            return LUDecomposition(*this).det();
+
+        const auto exponent = scaleToIntegers(values, _rows, _cols);
+        bignum::BigDecimal determinant;
+        if (_rows >= MODULAR_MIN_SIZE)
+            eliminateMultiModular(values, _rows, _cols, true, determinant);
+        else
+        {
+            const auto [pivots, oddPermutation] = eliminateFractionFree(values, _rows, _cols, false);
+            if (pivots.size() < _rows)
+                return 0;
+            determinant = values.back();
+            determinant.negative = determinant.negative != oddPermutation;
+        }
+        if (determinant.isZero())
+            return 0;
+        determinant.exponent = exponent;
+        bignum::stripTrailingZeros(determinant);
+        return Number(bignum::toString(determinant));
     }
 
-    Matrix Matrix::operator+(const Matrix& rhs) const
+    void Matrix::_checkSameSize(const Matrix& rhs, const std::string& name) const
     {
         if (rhs._cols != _cols)
         {
-            output::error("Matrix::operator+"s,
+            output::error(name,
                           $("mat2d",
                             "88331f88-3a4c-4b7e-9b43-b51a1d1020e2",
                             { std::to_string(_cols), std::to_string(rhs._cols) }));
@@ -332,55 +1325,123 @@ namespace steppable
         }
         if (rhs._rows != _rows)
         {
-            output::error("Matrix::operator+"s,
+            output::error(name,
                           $("mat2d",
                             "34e92306-a4d8-4ff0-8441-bfcd29771e94",
                             { std::to_string(_rows), std::to_string(rhs._rows) }));
             utils::programSafeExit(1);
         }
+    }
 
-        Matrix output = Matrix::zeros(_cols, _rows);
+    void Matrix::_checkSameRows(const Matrix& rhs, const std::string& name) const
+    {
+        if (rhs._rows != _rows)
+        {
+            output::error(name,
+                          $("mat2d",
+                            "f255d307-9482-442b-a523-61a1c7465f9c",
+                            { std::to_string(_rows), std::to_string(rhs._rows) }));
+            utils::programSafeExit(1);
+        }
+    }
 
-        for (size_t i = 0; i < _rows; i++)
-            for (size_t j = 0; j < _cols; j++)
-                output.data[i][j] += rhs.data[i][j];
+    Matrix Matrix::operator+(const Matrix& rhs) const&
+    {
+        Matrix output = *this;
+        output += rhs;
         return output;
     }
 
+    Matrix Matrix::operator+(const Matrix& rhs) &&
+    {
+        *this += rhs;
+        return std::move(*this);
+    }
+
+    Matrix Matrix::operator+(Matrix&& rhs) const&
+    {
+        _checkSameSize(rhs, "Matrix::operator+"s);
+        for (size_t i = 0; i < data.size(); i++)
+            rhs.data[i] = data[i] + rhs.data[i];
+        return std::move(rhs);
+    }
+
+    Matrix Matrix::operator+(Matrix&& rhs) && { return std::move(*this) + std::as_const(rhs); }
+
     Matrix Matrix::operator+() const { return *this; }
 
-    Matrix Matrix::operator+=(const Matrix& rhs)
+    Matrix& Matrix::operator+=(const Matrix& rhs)
     {
-        *this = *this + rhs;
+        _checkSameSize(rhs, "Matrix::operator+="s);
+        for (size_t i = 0; i < data.size(); i++)
+            data[i] += rhs.data[i];
         return *this;
     }
 
-    Matrix Matrix::operator-(const Matrix& rhs) const { return *this + -rhs; }
+    Matrix Matrix::operator-(const Matrix& rhs) const&
+    {
+        Matrix output = *this;
+        output -= rhs;
+        return output;
+    }
 
-    Matrix Matrix::operator-() const
+    Matrix Matrix::operator-(const Matrix& rhs) &&
+    {
+        *this -= rhs;
+        return std::move(*this);
+    }
+
+    Matrix Matrix::operator-(Matrix&& rhs) const&
+    {
+        _checkSameSize(rhs, "Matrix::operator-"s);
+        for (size_t i = 0; i < data.size(); i++)
+            rhs.data[i] = data[i] - rhs.data[i];
+        return std::move(rhs);
+    }
+
+    Matrix Matrix::operator-(Matrix&& rhs) && { return std::move(*this) - std::as_const(rhs); }
+
+    Matrix Matrix::operator-() const&
     {
         Matrix newMatrix = *this;
-        for (auto& row : newMatrix.data)
-            for (auto& value : row)
-                value = -value;
-        return newMatrix;
+        return -std::move(newMatrix);
+    }
+
+    Matrix Matrix::operator-() &&
+    {
+        for (auto& value : data)
+            value = -value;
+        return std::move(*this);
     }
 
-    Matrix Matrix::operator-=(const Matrix& rhs)
+    Matrix& Matrix::operator-=(const Matrix& rhs)
     {
-        *this = *this - rhs;
+        _checkSameSize(rhs, "Matrix::operator-="s);
+        for (size_t i = 0; i < data.size(); i++)
+            data[i] -= rhs.data[i];
         return *this;
     }
 
-    Matrix Matrix::operator*(const Number& rhs) const
+    Matrix Matrix::operator*(const Number& rhs) const&
     {
         Matrix newMatrix = *this;
-        for (auto& row : newMatrix.data)
-            for (auto& value : row)
-                value *= rhs;
+        newMatrix *= rhs;
         return newMatrix;
     }
 
+    Matrix Matrix::operator*(const Number& rhs) &&
+    {
+        *this *= rhs;
+        return std::move(*this);
+    }
+
+    Matrix& Matrix::operator*=(const Number& rhs)
+    {
+        for (auto& value : data)
+            value *= rhs;
+        return *this;
+    }
+
     Matrix Matrix::operator*(const Matrix& rhs) const
     {
         if (_cols != rhs._rows)
@@ -390,85 +1451,87 @@ namespace steppable
             output::info("Matrix::operator*"s, $("mat2d", "8966ce13-8ae9-4f14-ba4e-837b98a4c9fa"));
             utils::programSafeExit(1);
         }
-        Matrix matrix = Matrix::zeros(_rows, rhs._cols);
-        for (size_t j = 0; j < rhs._rows; j++)
-            for (size_t k = 0; k < _cols; k++)
-                for (size_t i = 0; i < _rows; i++)
-                    matrix.data[i][j] += data[i][k] * rhs.data[k][j];
-        return matrix;
-    }
 
-    Matrix Matrix::operator<<(const Matrix& rhs) const
-    {
-        if (rhs._rows != _rows)
+        Panel a(_rows, _cols);
+        Panel b(rhs._rows, rhs._cols);
+        if (not pack(getData(), a) or not pack(rhs.getData(), b))
         {
-            output::error("Matrix::operator<<"s,
-                          $("mat2d",
-                            "f255d307-9482-442b-a523-61a1c7465f9c",
-                            { std::to_string(rhs._rows), std::to_string(rhs._rows) }));
-            utils::programSafeExit(1);
+            // Non-numeric entries, such as "Infinity", are only handled by Number.
+            Matrix matrix = Matrix::zeros(_rows, rhs._cols);
+            for (size_t i = 0; i < _rows; i++)
+                for (size_t k = 0; k < _cols; k++)
+                    for (size_t j = 0; j < rhs._cols; j++)
+                        matrix.data[(i * rhs._cols) + j] += data[(i * _cols) + k] * rhs.data[(k * rhs._cols) + j];
+            return matrix;
         }
 
-        auto matrix = Matrix(_rows, _cols + rhs._cols);
-
-        // Copy current matrix.
-        for (size_t i = 0; i < _rows; i++)
-            for (size_t j = 0; j < _cols; j++)
-                matrix[{ .y = i, .x = j }] = data[i][j];
-
-        // Copy other matrix.
-        for (size_t i = 0; i < _rows; i++)
-            for (size_t j = 0; j < rhs._cols; j++)
-                matrix[{ .y = i, .x = j + _cols }] = rhs.data[i][j];
-
+        // Each entry is rounded once, to the precision that the entries of the operands are kept at.
+        const auto c = worthSplitting(a, b) ? multiplyPanels(a, b) : multiplyTiled(a, b);
+        const auto decimals = static_cast<long long>(std::max(prec, rhs.prec)) + 3;
+        Matrix matrix = Matrix::zeros(_rows, rhs._cols);
+        matrix.data = unpack(c.cells, decimals);
         return matrix;
     }
 
-    Matrix Matrix::operator>>(const Matrix& rhs) const
+    Matrix Matrix::operator<<(const Matrix& rhs) const
     {
-        if (rhs._rows != _rows)
-        {
-            output::error("Matrix::operator<<"s,
-                          $("mat2d",
-                            "f255d307-9482-442b-a523-61a1c7465f9c",
-                            { std::to_string(rhs._rows), std::to_string(rhs._rows) }));
-            utils::programSafeExit(1);
-        }
-
-        auto matrix = Matrix(_rows, _cols + rhs._cols);
-
-        // Copy other matrix.
-        for (size_t i = 0; i < _rows; i++)
-            for (size_t j = 0; j < rhs._cols; j++)
-                matrix[{ .y = i, .x = j }] = rhs.data[i][j];
-
-        // Copy current matrix.
-        for (size_t i = 0; i < _rows; i++)
-            for (size_t j = 0; j < _cols; j++)
-                matrix[{ .y = i, .x = j + _cols }] = data[i][j];
-
+        Matrix matrix = *this;
+        matrix <<= rhs;
         return matrix;
     }
 
-    Matrix Matrix::operator<<=(const Matrix& rhs)
+    Matrix Matrix::operator>>(const Matrix& rhs) const
     {
-        *this = *this << rhs;
-        return *this;
+        Matrix matrix = *this;
+        matrix >>= rhs;
+        return matrix;
     }
 
-    Matrix Matrix::operator>>=(const Matrix& rhs)
+    Matrix& Matrix::operator<<=(const Matrix& rhs)
     {
-        *this = *this >> rhs;
+        _checkSameRows(rhs, "Matrix::operator<<="s);
+        if (&rhs == this)
+            return *this <<= Matrix(rhs);
+
+        // Widen the rows from the last one, so that no row is overwritten before it is moved.
+        const size_t cols = _cols + rhs._cols;
+        const auto width = static_cast<std::ptrdiff_t>(_cols);
+        data.resize(_rows * cols);
+        for (size_t i = _rows; i-- > 0;)
+        {
+            const auto source = data.begin() + static_cast<std::ptrdiff_t>(i * _cols);
+            const auto target = data.begin() + static_cast<std::ptrdiff_t>(i * cols);
+            std::move_backward(source, source + width, target + width);
+            std::ranges::copy(rhs.row(i), target + width);
+        }
+        _cols = cols;
+        prec = std::max(prec, rhs.prec);
         return *this;
     }
 
-    Matrix Matrix::operator*=(const Number& rhs)
+    Matrix& Matrix::operator>>=(const Matrix& rhs)
     {
-        *this = *this * rhs;
+        _checkSameRows(rhs, "Matrix::operator>>="s);
+        if (&rhs == this)
+            return *this >>= Matrix(rhs);
+
+        // Widen the rows from the last one, so that no row is overwritten before it is moved.
+        const size_t cols = _cols + rhs._cols;
+        const auto width = static_cast<std::ptrdiff_t>(_cols);
+        data.resize(_rows * cols);
+        for (size_t i = _rows; i-- > 0;)
+        {
+            const auto source = data.begin() + static_cast<std::ptrdiff_t>(i * _cols);
+            const auto target = data.begin() + static_cast<std::ptrdiff_t>(i * cols);
+            std::move_backward(source, source + width, target + static_cast<std::ptrdiff_t>(cols));
+            std::ranges::copy(rhs.row(i), target);
+        }
+        _cols = cols;
+        prec = std::max(prec, rhs.prec);
         return *this;
     }
 
-    Matrix Matrix::operator*=(const Matrix& rhs)
+    Matrix& Matrix::operator*=(const Matrix& rhs)
     {
         *this = *this * rhs;
         return *this;
@@ -478,26 +1541,58 @@ namespace steppable
     {
         if (_rows != _cols)
         {
-            output::error("Matrix::operator^"s, "Matrix is not square."s);
+            output::error("Matrix::operator^"s, $("mat2d", "fe78bdc2-b409-4078-8e0e-313c46977f25"));
             utils::programSafeExit(1);
         }
 
-        auto matrix = *this;
+        bignum::BigDecimal exponent;
+        if (bignum::parse(times.present(), exponent))
+            bignum::stripTrailingZeros(exponent);
+        else
+            exponent.exponent = -1;
+        if (exponent.exponent < 0)
+        {
+            output::error("Matrix::operator^"s, $("mat2d", "0a03c9cb-e238-419f-90b9-b58c5f96b420", { times.present() }));
+            utils::programSafeExit(1);
+        }
+        if (exponent.isZero())
+            return diag(_rows);
+
+        // A^-n = (A^-1)^n, so the matrix is inverted only once.
+        auto matrix = exponent.negative ? LUDecomposition(*this).inverse() : *this;
+        const auto bits = bignum::toBase(bignum::shiftLeftDigits(exponent.mantissa, exponent.exponent), 2);
+        if (bits == "1")
+            return matrix;
 
-        // Take inverse of matrix
-        if (times == -1)
+        const auto decimals = static_cast<long long>(prec) + 3;
+        Panel base(_rows, _cols);
+        if (pack(matrix.getData(), base))
         {
-            matrix <<= diag(_rows);
-            matrix = matrix.rref();
-            matrix = matrix[{ .y1 = 0, .x1 = _rows, .y2 = _rows - 1, .x2 = _cols * 2 - 1 }];
+            matrix.data = unpack(power(base, bits, decimals).cells, decimals);
             return matrix;
         }
-        for (Number i = 0; i < times; ++i)
+
+        // Non-numeric entries, such as "Infinity", are only handled by Number.
+        const auto powerBase = matrix;
+        for (const char bit : std::string_view(bits).substr(1))
+        {
             matrix *= matrix;
+            if (bit == '1')
+                matrix *= powerBase;
+        }
         return matrix;
     }
 
-    std::string Matrix::present(const int endRows) const { return prettyPrint::printers::ppMatrix(data, endRows); }
+    Matrix& Matrix::operator^=(const Number& times)
+    {
+        *this = *this ^ times;
+        return *this;
+    }
+
+    std::string Matrix::present(const int endRows) const
+    {
+        return prettyPrint::printers::ppMatrix(getData(), endRows);
+    }
 
     Matrix Matrix::ones(const size_t rows, const size_t cols)
     {
@@ -519,13 +1614,18 @@ namespace steppable
         return matrix;
     }
 
-    Number Matrix::rank() const
+    Number Matrix::rank(const EliminationMode mode) const
     {
-        auto matrix = *this;
-        matrix = matrix.rref();
+        if (std::vector<bignum::BigDecimal> values(data.size()); exactValues(getData(), mode, values))
+        {
+            scaleToIntegers(values, _rows, _cols);
+            return { exactRank(values, _rows, _cols) };
+        }
+
+        const auto matrix = rref(EliminationMode::ROUNDED);
 
 #if defined(STP_DEB_MATRIX_REF_RESULT_INSPECT) && DEBUG
-        std::cout << prettyPrint::printers::ppMatrix(matrix.data) << "\n";
+        std::cout << prettyPrint::printers::ppMatrix(matrix.getData()) << "\n";
 #endif
         size_t rank = 0;
 
@@ -546,12 +1646,14 @@ namespace steppable
     {
         Matrix matrix(_cols, _rows);
         for (size_t i = 0; i < _cols; i++)
-            for (size_t j = 0; j < _rows; j++)
-                matrix[{ .y = j, .x = i }] = data[i][j];
+            std::ranges::copy(col(i), matrix.row(i).begin());
         return matrix;
     }
 
-    bool Matrix::operator==(const Matrix& rhs) const { return data == rhs.data; }
+    bool Matrix::operator==(const Matrix& rhs) const
+    {
+        return _rows == rhs._rows and _cols == rhs._cols and data == rhs.data;
+    }
 
     bool Matrix::operator!=(const Matrix& rhs) const { return not(*this == rhs); }
 
@@ -561,7 +1663,7 @@ namespace steppable
         const auto y = point.y;
 
         _checkIdxSanity(&point);
-        return data[y][x];
+        return data[(y * _cols) + x];
     }
 
     Number Matrix::operator[](const YXPoint& point) const
@@ -570,7 +1672,7 @@ namespace steppable
         const auto y = point.y;
 
         _checkIdxSanity(&point);
-        return data[y][x];
+        return data[(y * _cols) + x];
     }
 
     Matrix Matrix::operator[](const YX2Points& point) const
@@ -592,8 +1694,206 @@ namespace steppable
         auto matrix = Matrix(y2 - y1 + 1, x2 - x1 + 1);
 
         for (size_t i = y1; i <= y2; i++)
-            for (size_t j = x1; j <= x2; j++)
-                matrix[{ .y = i - y1, .x = j - x1 }] = data[i][j];
+        {
+            const auto source = data.begin() + static_cast<std::ptrdiff_t>((i * _cols) + x1);
+            std::copy(source, source + static_cast<std::ptrdiff_t>(matrix._cols), matrix.row(i - y1).begin());
+        }
         return matrix;
     }
+
+    LUDecomposition::LUDecomposition(const Matrix& matrix) :
+        size(matrix._rows),
+        prec(matrix.prec),
+        decimals(static_cast<long long>(matrix.prec) + 3 + LU_GUARD_DIGITS),
+        factors(matrix.data.size()),
+        permutation(matrix._rows)
+    {
+        if (matrix._rows != matrix._cols)
+        {
+            output::error("LUDecomposition"s, $("mat2d", "fe78bdc2-b409-4078-8e0e-313c46977f25"));
+            utils::programSafeExit(1);
+        }
+        if (not parseValues(matrix.getData(), factors))
+        {
+            output::error("LUDecomposition"s, $("mat2d", "54945f22-010a-4ce0-94a3-f0c4d8d84d0b"));
+            utils::programSafeExit(1);
+        }
+        for (size_t i = 0; i < size; i++)
+            permutation[i] = i;
+
+        // The factors are rounded, so a pivot that should be zero may be left over as a tiny number. Integer
+        // matrices are checked with their exact rank instead. For other matrices, a pivot below 10^-prec times the
+        // largest element of its column counts as zero.
+        const bool exact = std::ranges::all_of(factors, [](const auto& value) { return value.isInteger(); });
+        std::vector<bignum::BigDecimal> tolerances;
+        if (exact)
+        {
+            auto values = factors;
+            scaleToIntegers(values, size, size);
+            singular = exactRank(values, size, size) < size;
+        }
+        else
+        {
+            tolerances.resize(size);
+            for (size_t i = 0; i < size; i++)
+                for (size_t j = 0; j < size; j++)
+                    if (largerMagnitude(factors[(i * size) + j], tolerances[j]))
+                        tolerances[j] = factors[(i * size) + j];
+            for (auto& tolerance : tolerances)
+            {
+                tolerance.negative = false;
+                tolerance.exponent -= static_cast<long long>(prec);
+            }
+        }
+
+        for (size_t k = 0; k < size; k++)
+        {
+            size_t pivot = k;
+            for (size_t i = k + 1; i < size; i++)
+                if (largerMagnitude(factors[(i * size) + k], factors[(pivot * size) + k]))
+                    pivot = i;
+            if (const auto& pivotValue = factors[(pivot * size) + k];
+                pivotValue.isZero() or (not exact and largerMagnitude(tolerances[k], pivotValue)))
+            {
+                // Nothing is left to eliminate in this column.
+                singular = true;
+                continue;
+            }
+            if (pivot != k)
+            {
+                const auto pivotFirst = factors.begin() + static_cast<std::ptrdiff_t>(pivot * size);
+                std::swap_ranges(pivotFirst, pivotFirst + static_cast<std::ptrdiff_t>(size),
+                                 factors.begin() + static_cast<std::ptrdiff_t>(k * size));
+                std::swap(permutation[pivot], permutation[k]);
+                oddPermutation = not oddPermutation;
+            }
+
+            // The rows below the pivot are independent of each other.
+            const auto* pivotRow = factors.data() + (k * size);
+            utils::ThreadPool::instance().run(size - k - 1, [&](const size_t task) {
+                auto* row = factors.data() + ((k + 1 + task) * size);
+                if (row[k].isZero())
+                    return;
+                row[k] = bignum::divideRounded(row[k], pivotRow[k], decimals);
+                for (size_t j = k + 1; j < size; j++)
+                    if (not pivotRow[j].isZero())
+                        row[j] = bignum::roundOff(bignum::subtract(row[j], bignum::multiply(row[k], pivotRow[j])),
+                                                  decimals);
+            });
+        }
+    }
+
+    void LUDecomposition::_checkInvertible(const std::string& name) const
+    {
+        if (singular)
+        {
+            output::error(name, $("mat2d", "b53cf827-d292-4e24-964f-c834cdbe3d02"));
+            utils::programSafeExit(1);
+        }
+    }
+
+    void LUDecomposition::solveInPlace(std::vector<bignum::BigDecimal>& x) const
+    {
+        // Ly = Pb, where L has ones on its diagonal. Each element is summed exactly and rounded once.
+        for (size_t i = 0; i < size; i++)
+        {
+            const auto* row = factors.data() + (i * size);
+            for (size_t j = 0; j < i; j++)
+                if (not row[j].isZero() and not x[j].isZero())
+                    x[i] = bignum::subtract(x[i], bignum::multiply(row[j], x[j]));
+            x[i] = bignum::roundOff(x[i], decimals);
+        }
+
+        // Ux = y
+        for (size_t i = size; i-- > 0;)
+        {
+            const auto* row = factors.data() + (i * size);
+            for (size_t j = i + 1; j < size; j++)
+                if (not row[j].isZero() and not x[j].isZero())
+                    x[i] = bignum::subtract(x[i], bignum::multiply(row[j], x[j]));
+            x[i] = bignum::divideRounded(x[i], row[i], decimals);
+        }
+    }
+
+    Matrix LUDecomposition::lower() const
+    {
+        std::vector<bignum::BigDecimal> cells(factors.size());
+        for (size_t i = 0; i < size; i++)
+        {
+            std::copy_n(factors.begin() + static_cast<std::ptrdiff_t>(i * size),
+                        i,
+                        cells.begin() + static_cast<std::ptrdiff_t>(i * size));
+            cells[(i * size) + i] = bignum::fromInteger(1);
+        }
+        Matrix matrix = Matrix::zeros(size, size);
+        matrix.data = unpack(cells, static_cast<long long>(prec) + 3);
+        matrix.prec = prec;
+        return matrix;
+    }
+
+    Matrix LUDecomposition::upper() const
+    {
+        std::vector<bignum::BigDecimal> cells(factors.size());
+        for (size_t i = 0; i < size; i++)
+            std::copy(factors.begin() + static_cast<std::ptrdiff_t>((i * size) + i),
+                      factors.begin() + static_cast<std::ptrdiff_t>((i + 1) * size),
+                      cells.begin() + static_cast<std::ptrdiff_t>((i * size) + i));
+        Matrix matrix = Matrix::zeros(size, size);
+        matrix.data = unpack(cells, static_cast<long long>(prec) + 3);
+        matrix.prec = prec;
+        return matrix;
+    }
+
+    Number LUDecomposition::det() const
+    {
+        if (singular)
+            return 0;
+        auto determinant = bignum::fromInteger(oddPermutation ? -1 : 1);
+        for (size_t i = 0; i < size; i++)
+            determinant = bignum::roundOff(bignum::multiply(determinant, factors[(i * size) + i]), decimals);
+        return unpack({ &determinant, 1 }, static_cast<long long>(prec) + 3).front();
+    }
+
+    Matrix LUDecomposition::solve(const Matrix& b) const
+    {
+        if (b._rows != size)
+        {
+            output::error("LUDecomposition::solve"s,
+                          $("mat2d",
+                            "f255d307-9482-442b-a523-61a1c7465f9c",
+                            { std::to_string(size), std::to_string(b._rows) }));
+            utils::programSafeExit(1);
+        }
+        _checkInvertible("LUDecomposition::solve"s);
+
+        std::vector<bignum::BigDecimal> values(b.data.size());
+        if (not parseValues(b.getData(), values))
+        {
+            output::error("LUDecomposition::solve"s, $("mat2d", "54945f22-010a-4ce0-94a3-f0c4d8d84d0b"));
+            utils::programSafeExit(1);
+        }
+
+        // Every right-hand side is solved on its own, against the same factors.
+        std::vector<bignum::BigDecimal> solutions(values.size());
+        const size_t cols = b._cols;
+        utils::ThreadPool::instance().run(cols, [&](const size_t col) {
+            std::vector<bignum::BigDecimal> x(size);
+            for (size_t i = 0; i < size; i++)
+                x[i] = values[(permutation[i] * cols) + col];
+            solveInPlace(x);
+            for (size_t i = 0; i < size; i++)
+                solutions[(i * cols) + col] = std::move(x[i]);
+        });
+
+        Matrix matrix = Matrix::zeros(size, cols);
+        matrix.data = unpack(solutions, static_cast<long long>(prec) + 3);
+        matrix.prec = prec;
+        return matrix;
+    }
+
+    Matrix LUDecomposition::inverse() const
+    {
+        _checkInvertible("LUDecomposition::inverse"s);
+        return solve(Matrix::diag(size));
+    }
 } // namespace steppable
@@ -30,6 +30,7 @@
 
 #include "steppable/number.hpp"
 
+#include "bignum.hpp"
 #include "fn/calc.hpp"
 #include "output.hpp"
 #include "rounding.hpp"
@@ -46,44 +47,170 @@
 namespace steppable
 {
     using namespace steppable::__internals::calc;
+    namespace bignum = steppable::__internals::bignum;
 
-    Number::Number(std::string value, const size_t prec, const RoundingMode mode) :
-        value(std::move(value)), prec(prec), mode(mode)
+    Number::Number(std::string value, const size_t prec, const RoundingMode mode) : prec(prec), mode(mode)
     {
+        set(std::move(value));
     }
 
-    Number Number::operator+(const Number& rhs) const { return Number(add(value, rhs.value, 0), prec, mode); }
+    Number::Number(bignum::BigDecimal value, const size_t prec, const RoundingMode mode) : prec(prec), mode(mode)
+    {
+        assign(std::move(value));
+    }
+
+    Number::Number(const bignum::SmallDecimal& value, const size_t prec, const RoundingMode mode) :
+        small(value), prec(prec), mode(mode)
+    {
+    }
+
+    void Number::assign(bignum::BigDecimal newValue)
+    {
+        isSmall = bignum::narrow(newValue, small);
+        value = isSmall ? bignum::BigDecimal{} : std::move(newValue);
+    }
 
-    Number Number::operator-(const Number& rhs) const { return Number(subtract(value, rhs.value, 0), prec, mode); }
+    std::strong_ordering Number::compareValue(const Number& rhs) const
+    {
+        if (isSmall and rhs.isSmall)
+            return bignum::compare(small, rhs.small);
+        return bignum::compare(big(), rhs.big());
+    }
+
+    void Number::set(std::string newVal)
+    {
+        special.clear();
+        if (bignum::parse(newVal, small))
+        {
+            isSmall = true;
+            value = {};
+        }
+        else if (bignum::BigDecimal parsed; bignum::parse(newVal, parsed))
+            assign(std::move(parsed));
+        else
+        {
+            small = {};
+            isSmall = true;
+            value = {};
+            special = std::move(newVal);
+        }
+    }
+
+    void Number::setPrec(const size_t newPrec, const RoundingMode mode)
+    {
+        this->mode = mode;
+        prec = newPrec;
+        if (not special.empty())
+            return;
+        if (bignum::SmallDecimal rounded; isSmall and bignum::roundOff(small, static_cast<long long>(prec), rounded))
+            small = rounded;
+        else
+            assign(bignum::roundOff(big(), static_cast<long long>(prec)));
+    }
+
+    Number Number::operator+(const Number& rhs) const
+    {
+        if (eitherIsSpecial(rhs))
+            return propagateSpecial(rhs);
+        if (bignum::SmallDecimal result; isSmall and rhs.isSmall and bignum::add(small, rhs.small, result))
+        {
+            bignum::stripTrailingZeros(result);
+            return { result, prec, mode };
+        }
+        auto result = bignum::add(big(), rhs.big());
+        bignum::stripTrailingZeros(result);
+        return { std::move(result), prec, mode };
+    }
+
+    Number Number::operator-(const Number& rhs) const
+    {
+        if (eitherIsSpecial(rhs))
+            return propagateSpecial(rhs);
+        if (bignum::SmallDecimal result; isSmall and rhs.isSmall and bignum::subtract(small, rhs.small, result))
+        {
+            bignum::stripTrailingZeros(result);
+            return { result, prec, mode };
+        }
+        auto result = bignum::subtract(big(), rhs.big());
+        bignum::stripTrailingZeros(result);
+        return { std::move(result), prec, mode };
+    }
 
     Number Number::operator*(const Number& rhs) const
     {
+        if (eitherIsSpecial(rhs))
+            return propagateSpecial(rhs);
         const size_t usePrec = determinePrec<"operator*">(rhs);
-        const auto result = multiply(value, rhs.value, 0, static_cast<int>(usePrec) + 2);
-        return Number{ __internals::numUtils::roundOff(result, usePrec), usePrec, mode };
+        const auto decimals = static_cast<long long>(usePrec);
+        if (bignum::SmallDecimal result;
+            isSmall and rhs.isSmall and bignum::multiply(small, rhs.small, decimals, result))
+            return { result, usePrec, mode };
+        auto result = bignum::multiply(big(), rhs.big());
+        bignum::stripTrailingZeros(result);
+        return { bignum::roundOff(result, decimals), usePrec, mode };
     }
 
     Number Number::operator/(const Number& rhs) const
     {
+        if (eitherIsSpecial(rhs))
+            return propagateSpecial(rhs);
         const size_t usePrec = determinePrec<"operator/">(rhs);
-        const auto result = divide(value, rhs.value, 0, static_cast<int>(usePrec) + 2);
-        return Number{ __internals::numUtils::roundOff(result, usePrec), usePrec, mode };
+        if (rhs.isZero())
+        {
+            // Let divide() report the error.
+            const auto result = divide(present(), rhs.present(), 0, static_cast<int>(usePrec) + 2);
+            return Number{ __internals::numUtils::roundOff(result, usePrec), usePrec, mode };
+        }
+
+        // Same as divide(), the quotient is first rounded to two extra places, then to the precision.
+        const auto decimals = static_cast<long long>(usePrec);
+        const bool isOne = rhs.compareValue(Number(1)) == 0;
+        if (isSmall and rhs.isSmall)
+        {
+            bignum::SmallDecimal result;
+            bool fits = true;
+            if (compareValue(rhs) == 0)
+                result.mantissa = 1;
+            else if (isOne)
+                fits = bignum::roundOff(small, decimals + 2, result);
+            else if (not small.isZero())
+                fits = bignum::divideRounded(small, rhs.small, decimals + 2, result);
+            if (fits and bignum::roundOff(result, decimals, result))
+                return { result, usePrec, mode };
+        }
+
+        bignum::BigDecimal result;
+        if (compareValue(rhs) == 0)
+            result = bignum::fromInteger(1);
+        else if (isOne)
+            result = bignum::roundOff(big(), decimals + 2);
+        else if (not isZero())
+            result = bignum::divideRounded(big(), rhs.big(), decimals + 2);
+        return { bignum::roundOff(result, decimals), usePrec, mode };
     }
 
     Number Number::operator%(const Number& rhs) const
     {
-        return Number(divideWithQuotient(value, rhs.value).remainder, prec, mode);
+        if (eitherIsSpecial(rhs))
+            return propagateSpecial(rhs);
+        return Number(divideWithQuotient(present(), rhs.present()).remainder, prec, mode);
     }
 
     Number Number::mod(const Number& rhs) const
     {
-        return Number(divideWithQuotient(value, rhs.value).quotient, prec, mode);
+        if (eitherIsSpecial(rhs))
+            return propagateSpecial(rhs);
+        return Number(divideWithQuotient(present(), rhs.present()).quotient, prec, mode);
     }
 
     Number Number::operator^(const Number& rhs)
     {
+        if (eitherIsSpecial(rhs))
+            return propagateSpecial(rhs);
         const size_t usePrec = determinePrec<"operator^">(rhs);
-        return Number(power(value, rhs.value, 0, static_cast<int>(usePrec)), usePrec, mode);
+        if (long long exponent = 0; bignum::toInteger(rhs.big(), exponent) and (exponent >= 0 or not isZero()))
+            return { bignum::power(big(), exponent, static_cast<long long>(usePrec)), usePrec, mode };
+        return Number(power(present(), rhs.present(), 0, static_cast<int>(usePrec)), usePrec, mode);
     }
 
     Number& Number::operator+=(const Number& rhs)
@@ -125,23 +252,29 @@ namespace steppable
         return *this;
     }
 
-    bool Number::operator==(const Number& rhs) const { return compare(value, rhs.value, 0) == "2"; }
-
-    bool Number::operator!=(const Number& rhs) const { return compare(value, rhs.value, 0) != "2"; }
-
-    bool Number::operator<(const Number& rhs) const { return compare(value, rhs.value, 0) == "0"; }
-
-    bool Number::operator>(const Number& rhs) const { return compare(value, rhs.value, 0) == "1"; }
+    bool Number::operator==(const Number& rhs) const
+    {
+        if (eitherIsSpecial(rhs))
+            return special == rhs.special;
+        return compareValue(rhs) == 0;
+    }
 
-    bool Number::operator<=(const Number& rhs) const { return compare(value, rhs.value, 0) != "1"; }
+    bool Number::operator!=(const Number& rhs) const { return not(*this == rhs); }
 
-    bool Number::operator>=(const Number& rhs) const { return compare(value, rhs.value, 0) != "0"; }
+    std::partial_ordering Number::operator<=>(const Number& rhs) const
+    {
+        if (eitherIsSpecial(rhs))
+            return std::partial_ordering::unordered;
+        return compareValue(rhs);
+    }
 
     Number Number::operator-() const
     {
-        auto newValue = "-" + value;
-        newValue = __internals::numUtils::standardizeNumber(newValue);
-        Number number(newValue, prec, mode);
+        Number number = *this;
+        if (isSmall)
+            number.small.negative = not small.negative and not small.isZero();
+        else
+            number.value.negative = not value.negative and not value.isZero();
         return number;
     }
 
@@ -149,17 +282,22 @@ namespace steppable
 
     Number Number::operator++()
     {
-        *this += Number("1");
+        *this += Number(1);
         return *this;
     }
 
     Number Number::operator--()
     {
-        *this -= Number("1");
+        *this -= Number(1);
         return *this;
     }
 
-    std::string Number::present() const { return value; }
+    std::string Number::present() const
+    {
+        if (not special.empty())
+            return special;
+        return isSmall ? bignum::toString(small) : bignum::toString(value);
+    }
 } // namespace steppable
 
 std::ostream& operator<<(std::ostream& os, const steppable::Number& number)
@@ -0,0 +1,160 @@
+/**************************************************************************************************
+ * Copyright (c) 2023-2025 NWSOFT                                                                 *
+ *                                                                                                *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy                   *
+ * of this software and associated documentation files (the "Software"), to deal                  *
+ * in the Software without restriction, including without limitation the rights                   *
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell                      *
+ * copies of the Software, and to permit persons to whom the Software is                          *
+ * furnished to do so, subject to the following conditions:                                       *
+ *                                                                                                *
+ * The above copyright notice and this permission notice shall be included in all                 *
+ * copies or substantial portions of the Software.                                                *
+ *                                                                                                *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR                     *
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,                       *
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE                    *
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER                         *
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,                  *
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE                  *
+ * SOFTWARE.                                                                                      *
+ **************************************************************************************************/
+
+
+/**
+ * @file threadPool.cpp
+ * @brief This file contains the implementation of the ThreadPool class, which runs independent tasks on worker threads.
+ *
+ * @author Andy Zhang
+ * @date 17th October 2026
+ */
+
+#include "threadPool.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+
+namespace steppable::__internals::utils
+{
+    namespace
+    {
+        /// @brief Whether the current thread is running a task, in which case new jobs run sequentially.
+        thread_local bool insideTask = false;
+    } // namespace
+
+    /**
+     * @struct ThreadPool::Job
+     * @brief The tasks started by one call to run().
+     */
+    struct ThreadPool::Job
+    {
+        const std::function<void(size_t)>* task = nullptr; ///< The task, owned by the caller of run().
+        size_t count = 0; ///< The number of tasks.
+        std::atomic<size_t> next = 0; ///< The next task to hand out.
+        size_t finished = 0; ///< The number of tasks that have finished, guarded by the pool's mutex.
+        std::exception_ptr error; ///< The first exception thrown by a task, guarded by the pool's mutex.
+    };
+
+    ThreadPool::ThreadPool(const size_t workerCount)
+    {
+        workers.reserve(workerCount);
+        for (size_t i = 0; i < workerCount; i++)
+            workers.emplace_back([this] { workerLoop(); });
+    }
+
+    ThreadPool::~ThreadPool()
+    {
+        {
+            const std::scoped_lock lock(mutex);
+            stopping = true;
+        }
+        jobAdded.notify_all();
+        workers.clear(); // Joins the threads.
+    }
+
+    ThreadPool& ThreadPool::instance()
+    {
+        static ThreadPool pool(std::max(std::thread::hardware_concurrency(), 1U) - 1);
+        return pool;
+    }
+
+    size_t ThreadPool::concurrency() const { return workers.size() + 1; }
+
+    void ThreadPool::run(const size_t count, const std::function<void(size_t)>& task)
+    {
+        if (workers.empty() or count <= 1 or insideTask)
+        {
+            for (size_t i = 0; i < count; i++)
+                task(i);
+            return;
+        }
+
+        const auto job = std::make_shared<Job>();
+        job->task = &task;
+        job->count = count;
+        {
+            const std::scoped_lock lock(mutex);
+            jobs.push_back(job);
+        }
+        jobAdded.notify_all();
+
+        work(*job);
+        std::unique_lock lock(mutex);
+        jobFinished.wait(lock, [&job] { return job->finished == job->count; });
+        if (job->error)
+            std::rethrow_exception(job->error);
+    }
+
+    void ThreadPool::work(Job& job)
+    {
+        insideTask = true;
+        size_t finished = 0;
+        std::exception_ptr error;
+        for (size_t i = job.next++; i < job.count; i = job.next++, finished++)
+        {
+            try
+            {
+                (*job.task)(i);
+            }
+            catch (...)
+            {
+                if (not error)
+                    error = std::current_exception();
+            }
+        }
+        insideTask = false;
+
+        if (finished == 0)
+            return;
+        const std::scoped_lock lock(mutex);
+        if (error and not job.error)
+            job.error = error;
+        job.finished += finished;
+        if (job.finished == job.count)
+            jobFinished.notify_all();
+    }
+
+    void ThreadPool::workerLoop()
+    {
+        while (true)
+        {
+            std::shared_ptr<Job> job;
+            {
+                std::unique_lock lock(mutex);
+                jobAdded.wait(lock, [this] { return stopping or not jobs.empty(); });
+                if (jobs.empty())
+                    return;
+
+                // A job whose tasks have all been handed out only has to be waited for by its caller.
+                job = jobs.front();
+                if (job->next >= job->count)
+                {
+                    jobs.pop_front();
+                    continue;
+                }
+            }
+            work(*job);
+        }
+    }
+} // namespace steppable::__internals::utils
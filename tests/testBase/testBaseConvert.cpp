@@ -21,12 +21,32 @@
  **************************************************************************************************/
 
 #include "colors.hpp"
+#include "fn/calc.hpp"
 #include "output.hpp"
 #include "testing.hpp"
 #include "util.hpp"
 
 #include <iomanip>
 #include <iostream>
+#include <string>
 
 TEST_START()
+
+using namespace steppable::__internals::calc;
+
+SECTION(Base Convert)
+_.assertIsEqual(baseConvert("255", "16", 0), "FF");
+_.assertIsEqual(baseConvert("10", "16", 0), "A");
+_.assertIsEqual(baseConvert("0", "2", 0), "0");
+_.assertIsEqual(baseConvert("-5", "2", 0), "-101");
+_.assertIsEqual(baseConvert("2649229669977", "8", 0), "46432231133131");
+SECTION_END()
+
+SECTION(Base Convert of large numbers)
+// 16^2000 - 1 is written with 2000 Fs, and 2^8000 is 1 followed by 8000 zeros in binary.
+const std::string number = decimalConvert(std::string(2000, 'F'), "16", 0);
+_.assertIsEqual(baseConvert(number, "16", 0), std::string(2000, 'F'));
+_.assertIsEqual(baseConvert(decimalConvert("1" + std::string(8000, '0'), "2", 0), "2", 0), "1" + std::string(8000, '0'));
+SECTION_END()
+
 TEST_END()
@@ -48,4 +48,11 @@ const auto& result = decimalConvert(a, b, 0);
 
 _.assertIsEqual(result, "2186");
 SECTION_END()
+
+SECTION(Decimal Convert of large numbers)
+// 36^100 - 1 is written with 100 Zs.
+_.assertIsEqual(decimalConvert(std::string(100, 'z'), "36", 0), subtract(power("36", "100", 0), "1", 0));
+_.assertIsEqual(decimalConvert("1" + std::string(64, '0'), "2", 0), "18446744073709551616");
+_.assertIsEqual(decimalConvert("12", "2", 0), "Impossible");
+SECTION_END()
 TEST_END()
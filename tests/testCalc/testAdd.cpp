@@ -59,4 +59,10 @@ const auto& addResult2 = add(b, a, 0); // Makes sure it works when a and b are r
 _.assertIsEqual(addResult1, "-11614.261");
 _.assertIsEqual(addResult1, addResult2);
 SECTION_END()
+
+SECTION(Addition of a number and its negation)
+_.assertIsEqual(add("-0.00012", "0.00012", 0), "0");
+_.assertIsEqual(add("123.456", "-123.456", 0), "0");
+_.assertIsEqual(add("-7", "7", 0), "0");
+SECTION_END()
 TEST_END()
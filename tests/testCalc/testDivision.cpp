@@ -93,4 +93,24 @@ const std::string& res = divideWithQuotient(a, b).remainder;
 _.assertIsEqual(res, "1.5");
 SECTION_END()
 
+SECTION(Division of large numbers)
+// (10^n - 1)^2 / (10^n - 1) = 10^n - 1
+for (const size_t n : { 500, 5000, 10000 })
+{
+    const std::string nines(n, '9');
+    _.assertIsEqual(divide(multiply(nines, nines, 0), nines, 0, 0), nines);
+    _.assertIsEqual(divideWithQuotient(multiply(nines, nines, 0) + "7", nines + "0").remainder, "7");
+}
+SECTION_END()
+
+SECTION(Greatest common divisor)
+_.assertIsEqual(getGCD("12", "18"), "6");
+_.assertIsEqual(getGCD("-12", "18"), "6");
+_.assertIsEqual(getGCD("0", "7"), "7");
+_.assertIsEqual(getGCD("1.5", "2.25"), "0.75");
+// Consecutive Fibonacci numbers are coprime, and the worst case for Euclid's algorithm.
+_.assertIsEqual(getGCD("354224848179261915075", "573147844013817084101"), "1");
+_.assertIsEqual(getGCD(multiply("354224848179261915075", "1000000007", 0), "1000000014000000049"), "1000000007");
+SECTION_END()
+
 TEST_END()
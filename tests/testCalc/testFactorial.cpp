@@ -34,5 +34,14 @@ using namespace steppable::__internals::calc;
 TEST_START()
 SECTION(Factorial)
 _.assertIsEqual(factorial("5", 0), "120");
+_.assertIsEqual(factorial("25", 0), "15511210043330985984000000");
+_.assertIsEqual(factorial("1000", 0).substr(0, 20), "40238726007709377354");
+SECTION_END()
+
+SECTION(Binomial)
+_.assertIsEqual(binomial("52", "5"), "2598960");
+_.assertIsEqual(binomial("100", "50"), "100891344545564193334812497256");
+_.assertIsEqual(binomial("1000000000000", "3"), "166666666666166666666667000000000000");
+_.assertIsEqual(binomial("5", "7"), "0");
 SECTION_END()
 TEST_END()
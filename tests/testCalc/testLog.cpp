@@ -34,6 +34,12 @@ using namespace steppable::__internals::calc;
 
 SECTION(Test natural logarithm)
 _.assertIsEqual(ln("5.3", 4), "1.6677");
+_.assertIsEqual(ln("0.001", 5), "-6.90776");
+SECTION_END()
+
+SECTION(Test logarithm with a base)
+_.assertIsEqual(logb("5", "3", 6), "1.464974");
+_.assertIsEqual(log10("1000", 4), "3.0000");
 SECTION_END()
 
 TEST_END()
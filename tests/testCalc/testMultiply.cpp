@@ -68,4 +68,16 @@ const auto& multiplyResult2 = multiply(b, a, 0); // Makes sure it works when a a
 _.assertIsEqual(multiplyResult1, "-108");
 _.assertIsEqual(multiplyResult1, multiplyResult2);
 SECTION_END()
+
+SECTION(Multiplication of large numbers)
+// (10^n - 1)^2 = 99...9800...01, which goes through Karatsuba for n = 500, Toom-3 for n = 5000 and the NTT for
+// n = 10000.
+for (const size_t n : { 500, 5000, 10000 })
+{
+    const std::string a(n, '9');
+    const auto& multiplyResult = multiply(a, a, 0);
+    _.assertIsEqual(multiplyResult, std::string(n - 1, '9') + "8" + std::string(n - 1, '0') + "1");
+}
+_.assertIsEqual(multiply(std::string(400, '9') + ".5", "-2", 0, 1), "-1" + std::string(400, '9') + ".0");
+SECTION_END()
 TEST_END()
@@ -58,6 +58,16 @@ const auto& result = power(number, raiseTo, 0, 8);
 _.assertIsEqual(result, "0.00097656");
 SECTION_END()
 
+SECTION(Power with Negative Exponents)
+_.assertIsEqual(power("2", "-3", 0, 5), "0.12500");
+_.assertIsEqual(power("-1.5", "-3", 0, 4), "-0.2963");
+SECTION_END()
+
+SECTION(Power with Large Exponents)
+_.assertIsEqual(power("3", "1000", 0, 0).substr(0, 10), "1322070819");
+_.assertTrue(power("3", "1000", 0, 0).size() == 478);
+SECTION_END()
+
 SECTION(Power with Decimal Exponents)
 const std::string number = "4";
 const std::string raiseTo = "0.5";
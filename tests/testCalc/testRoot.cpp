@@ -35,6 +35,15 @@ using namespace steppable::__internals::calc;
 _.assertIsEqual(root("4", "2", 0), "2");
 SECTION_END()
 
+SECTION(Root with rounding)
+using namespace steppable::__internals::calc;
+_.assertIsEqual(root("2", "2", 10), "1.4142135624");
+_.assertIsEqual(root("72", "2", 5), "8.48528");
+_.assertIsEqual(root("0.001", "3", 4), "0.1000");
+_.assertIsEqual(root("-8", "3", 2), "-2.00");
+_.assertIsEqual(rootIntPart("26", "3"), "2");
+SECTION_END()
+
 SECTION(Root with a decimal index)
 using namespace steppable::__internals::calc;
 _.assertIsEqual(root("4", "0.5", 0), "16");
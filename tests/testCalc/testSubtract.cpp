@@ -41,4 +41,10 @@ const auto& subtractResult = subtract(a, b, 0);
 _.assertIsEqual(subtractResult, "47983.784");
 SECTION_END()
 
+SECTION(Subtraction of a number from itself)
+_.assertIsEqual(subtract("0.5", "0.5", 0), "0");
+_.assertIsEqual(subtract("123.456", "123.456", 0), "0");
+_.assertIsEqual(subtract("-0.001", "-0.001", 0), "0");
+SECTION_END()
+
 TEST_END()
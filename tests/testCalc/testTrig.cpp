@@ -36,12 +36,24 @@ using namespace steppable::__internals::calc;
 SECTION(Test sine and cosine)
 _.assertIsEqual(sin("30", 2, 1), "0.50");
 _.assertIsEqual(cos("60", 2, 1), "0.50");
+_.assertIsEqual(sin("-2.5", 8, 0), "-0.59847214");
+const auto [sine, cosine] = sincos("1", 10, 0);
+_.assertIsEqual(sine, "0.8414709848");
+_.assertIsEqual(cosine, "0.5403023059");
 SECTION_END()
 
 SECTION(Test tangent)
 _.assertIsEqual(tan("45", 2, 1), "1.00");
 // Zero check test
 _.assertIsEqual(tan("90", 2, 1), "Infinity");
+_.assertIsEqual(tan("1", 8, 0), "1.55740772");
+SECTION_END()
+
+SECTION(Test reciprocal functions)
+_.assertIsEqual(sec("1", 6, 0), "1.850816");
+_.assertIsEqual(csc("1", 6, 0), "1.188395");
+_.assertIsEqual(cot("1", 6, 0), "0.642093");
+_.assertIsEqual(cot("0", 4, 0), "Infinity");
 SECTION_END()
 
 SECTION(Test arc cosine)
@@ -0,0 +1,310 @@
+/**************************************************************************************************
+ * Copyright (c) 2023-2025 NWSOFT                                                                 *
+ *                                                                                                *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy                   *
+ * of this software and associated documentation files (the "Software"), to deal                  *
+ * in the Software without restriction, including without limitation the rights                   *
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell                      *
+ * copies of the Software, and to permit persons to whom the Software is                          *
+ * furnished to do so, subject to the following conditions:                                       *
+ *                                                                                                *
+ * The above copyright notice and this permission notice shall be included in all                 *
+ * copies or substantial portions of the Software.                                                *
+ *                                                                                                *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR                     *
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,                       *
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE                    *
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER                         *
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,                  *
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE                  *
+ * SOFTWARE.                                                                                      *
+ **************************************************************************************************/
+
+#include "bignum.hpp"
+#include "colors.hpp"
+#include "output.hpp"
+#include "testing.hpp"
+#include "util.hpp"
+
+#include <iomanip>
+#include <iostream>
+
+TEST_START()
+using namespace steppable::__internals::bignum;
+
+const auto roundTrip = [](const std::string& string) {
+    BigDecimal number;
+    parse(string, number);
+    return toString(number);
+};
+using Operation = BigDecimal (*)(const BigDecimal&, const BigDecimal&);
+const auto apply = [](const std::string& a, const std::string& b, const Operation function) {
+    BigDecimal aNumber;
+    BigDecimal bNumber;
+    parse(a, aNumber);
+    parse(b, bNumber);
+    return toString(function(aNumber, bNumber));
+};
+
+SECTION(Parsing and Presenting)
+_.assertIsEqual(roundTrip("123456789012345678901234567890"), "123456789012345678901234567890");
+_.assertIsEqual(roundTrip("-0.000000000012345"), "-0.000000000012345");
+_.assertIsEqual(roundTrip("1.50"), "1.50");
+_.assertIsEqual(roundTrip("--42"), "42");
+_.assertIsEqual(roundTrip("-0.00"), "0.00");
+_.assertIsEqual(roundTrip(".5"), "0.5");
+BigDecimal number;
+_.assertFalse(parse("Infinity", number));
+_.assertFalse(parse("", number));
+_.assertFalse(parse("1.2.3", number));
+SECTION_END()
+
+SECTION(Addition and Subtraction)
+_.assertIsEqual(apply("999999999.999999999", "0.000000001", add), "1000000000.000000000");
+_.assertIsEqual(apply("-123456789123456789", "123456789123456790", add), "1");
+_.assertIsEqual(apply("1.5", "2.25", subtract), "-0.75");
+_.assertIsEqual(apply("1000000000000000000", "1", subtract), "999999999999999999");
+SECTION_END()
+
+SECTION(Multiplication)
+_.assertIsEqual(apply("123456789123456789", "987654321987654321", multiply), "121932631356500531347203169112635269");
+_.assertIsEqual(apply("-1.5", "0.2", multiply), "-0.30");
+_.assertIsEqual(apply("0", "-5", multiply), "0");
+
+Limbs a;
+Limbs b;
+for (Limb i = 0; i < 700; i++)
+{
+    a.push_back((i * 2654435761U) % LIMB_BASE);
+    if (i < 450)
+        b.push_back((i * 40503U + 7) % LIMB_BASE);
+}
+const auto expected = multiplySchoolbook(a, b);
+_.assertTrue(multiplyKaratsuba(a, b) == expected);
+_.assertTrue(multiplyToom3(a, b) == expected);
+_.assertTrue(multiplyNTT(a, b) == expected);
+_.assertTrue(multiplyMagnitude(a, b) == expected);
+
+multiplyThresholds().selfCheck = true;
+const Limbs nines(2000, LIMB_BASE - 1);
+_.assertTrue(multiplyNTT(nines, nines) == multiplyToom3(nines, nines));
+multiplyThresholds().selfCheck = false;
+SECTION_END()
+
+SECTION(Comparison)
+const auto order = [](const std::string& a, const std::string& b) {
+    BigDecimal aNumber;
+    BigDecimal bNumber;
+    parse(a, aNumber);
+    parse(b, bNumber);
+    return compare(aNumber, bNumber);
+};
+_.assertTrue(order("1.50", "1.5") == 0);
+_.assertTrue(order("-2", "1") < 0);
+_.assertTrue(order("10", "9.99") > 0);
+_.assertTrue(order("123456789.123456789", "123456789.12345678") > 0);
+_.assertTrue(order("-0.000000001", "-0.00000000100") == 0);
+
+_.assertTrue(compare("1.50", "1.5") == 0);
+_.assertTrue(compare("-0", "0.000") == 0);
+_.assertTrue(compare("-12.5", "-12.25") < 0);
+_.assertTrue(compare("007", "6.999") > 0);
+_.assertTrue(compare("abc", "1") == std::partial_ordering::unordered);
+SECTION_END()
+
+SECTION(Rounding)
+_.assertIsEqual(apply("2.345", "0", [](const auto& a, const auto&) { return roundOff(a, 2); }), "2.35");
+_.assertIsEqual(apply("-0.9999", "0", [](const auto& a, const auto&) { return roundOff(a, 3); }), "-1.000");
+_.assertIsEqual(apply("2.5", "0", [](const auto& a, const auto&) { return roundOff(a, 0); }), "3");
+_.assertIsEqual(apply("0.1", "0", [](const auto& a, const auto&) { return roundOff(a, 4); }), "0.1000");
+_.assertIsEqual(apply("12", "0", [](const auto& a, const auto&) { return roundOff(a, 4); }), "12");
+SECTION_END()
+
+SECTION(Division)
+_.assertIsEqual(apply("1", "3", [](const auto& a, const auto& b) { return divideRounded(a, b, 5); }), "0.33333");
+_.assertIsEqual(apply("-2", "3", [](const auto& a, const auto& b) { return divideRounded(a, b, 2); }), "-0.67");
+_.assertIsEqual(apply("-7", "2", [](const auto& a, const auto& b) { return divideRounded(a, b, 0); }), "-3");
+_.assertIsEqual(apply("1", "300", [](const auto& a, const auto& b) { return divideRounded(a, b, 2); }), "0");
+_.assertIsEqual(apply("1.5", "0.25", [](const auto& a, const auto& b) { return divideTruncated(a, b, 1); }), "6.0");
+
+Limbs a;
+Limbs b;
+for (Limb i = 0; i < 1500; i++)
+{
+    a.push_back((i * 2654435761U) % LIMB_BASE);
+    if (i < 600)
+        b.push_back((i * 40503U + 7) % LIMB_BASE);
+}
+const auto knuth = divideKnuth(a, b);
+const auto newton = divideNewton(a, b);
+_.assertTrue(knuth.quotient == newton.quotient);
+_.assertTrue(knuth.remainder == newton.remainder);
+_.assertTrue(addMagnitude(multiplyMagnitude(knuth.quotient, b), knuth.remainder) == a);
+_.assertTrue(compareMagnitude(knuth.remainder, b) < 0);
+SECTION_END()
+
+SECTION(Small Numbers)
+const auto small = [](const std::string& string) {
+    SmallDecimal number;
+    parse(string, number);
+    return number;
+};
+_.assertIsEqual(toString(small("-001.50")), "-1.50");
+_.assertIsEqual(toString(small("0.00")), "0.00");
+_.assertTrue(compare(small("2.5"), small("2.50")) == 0);
+_.assertTrue(compare(small("-3"), small("-2.999")) < 0);
+
+SmallDecimal out;
+SmallDecimal big;
+_.assertTrue(not parse("18446744073709551616", big));
+_.assertTrue(add(small("18446744073709551615"), small("-1"), out));
+_.assertIsEqual(toString(out), "18446744073709551614");
+_.assertTrue(not add(small("18446744073709551615"), small("1"), out));
+_.assertTrue(multiply(small("0.3333333333"), small("0.3333333333"), 10, out));
+_.assertIsEqual(toString(out), "0.1111111111");
+_.assertTrue(not multiply(small("4294967296"), small("4294967296"), 10, out));
+_.assertTrue(divideRounded(small("-2"), small("3"), 4, out));
+_.assertIsEqual(toString(out), "-0.6667");
+_.assertTrue(roundOff(small("2.345"), 2, out));
+_.assertIsEqual(toString(out), "2.35");
+_.assertTrue(narrow(widen(small("-12.75")), out));
+_.assertIsEqual(toString(out), "-12.75");
+SECTION_END()
+
+SECTION(Series and Exponential)
+const HypergeometricSeries series{
+    .p = [](long long) { return fromInteger(1); },
+    .q = [](const long long k) { return fromInteger(k == 0 ? 1 : k); },
+};
+_.assertIsEqual(toString(sumSeries(series, 30, 20)), "2.71828182845904523536");
+
+const auto exponential = [](const std::string& string, const long long decimals) {
+    BigDecimal number;
+    parse(string, number);
+    return toString(exp(number, decimals));
+};
+_.assertIsEqual(exponential("0", 5), "1");
+_.assertIsEqual(exponential("1", 30), "2.718281828459045235360287471353");
+_.assertIsEqual(exponential("0.5", 20), "1.64872127070012814685");
+_.assertIsEqual(exponential("10", 4), "22026.4658");
+_.assertIsEqual(exponential("-2.5", 15), "0.082084998623899");
+_.assertIsEqual(exponential("-100", 10), "0.0000000000");
+SECTION_END()
+
+SECTION(Constants)
+_.assertIsEqual(toString(pi(30)), "3.141592653589793238462643383280");
+_.assertIsEqual(toString(e(30)), "2.718281828459045235360287471353");
+_.assertIsEqual(toString(ln2(30)), "0.693147180559945309417232121458");
+_.assertIsEqual(toString(ln10(30)), "2.302585092994045684017991454684");
+// A less precise request rounds the cached value off.
+_.assertIsEqual(toString(pi(3)), "3.142");
+_.assertIsEqual(toString(pi(1000)).substr(992), "2164201989");
+SECTION_END()
+
+SECTION(Square Root and Logarithm)
+BigDecimal two;
+parse("2", two);
+_.assertIsEqual(toString(squareRoot(two, 30)), "1.414213562373095048801688724209");
+_.assertTrue(squareRootMagnitude({ 0, 0, 16 }) == Limbs{ 0, 4 });
+_.assertTrue(squareRootMagnitude({ 999999999, 999999999, 15 }) == Limbs{ 999999999, 3 });
+_.assertIsEqual(toString(nthRoot(two, 3, 30)), "1.259921049894873164767210607278");
+_.assertIsEqual(toString(nthRoot(fromInteger(1000000), 6, 5)), "10.00000");
+_.assertIsEqual(toString(power(fromInteger(3), 40)), "12157665459056928801");
+_.assertIsEqual(toString(power(fromInteger(7), 300)).substr(0, 10), "3383857020");
+_.assertIsEqual(toString(power(fromInteger(-4), -3, 6)), "-0.015625");
+
+BigDecimal number;
+parse("7.5", number);
+_.assertIsEqual(toString(lnNewton(number, 30)), "2.014903020542264756578772448691");
+_.assertIsEqual(toString(lnAGM(number, 30)), "2.014903020542264756578772448691");
+parse("0.001", number);
+_.assertIsEqual(toString(ln(number, 20)), "-6.90775527898213705205");
+parse("12345.678", number);
+_.assertIsEqual(toString(ln(number, 15)), "9.421061321291832");
+SECTION_END()
+
+SECTION(Factorial)
+_.assertIsEqual(toString(productTree({})), "1");
+_.assertIsEqual(toString(productTree({ 4294967296, 4294967296, 3 })), "55340232221128654848");
+_.assertIsEqual(toString(factorial(0)), "1");
+_.assertIsEqual(toString(factorial(25)), "15511210043330985984000000");
+_.assertIsEqual(toString(binomial(100, 50)), "100891344545564193334812497256");
+_.assertIsEqual(toString(binomial(40, 1)), "40");
+SECTION_END()
+
+SECTION(Sine and Cosine)
+BigDecimal angle;
+parse("0.5", angle);
+const auto [sine, cosine] = sincos(angle, 20);
+_.assertIsEqual(toString(sine), "0.47942553860420300027");
+_.assertIsEqual(toString(cosine), "0.87758256189037271612");
+// Degrees are reduced exactly, so sin(30 deg) is exactly 0.5.
+_.assertIsEqual(toString(sincos(fromInteger(30), 5, 90).sine), "0.50000");
+parse("-2.5", angle);
+_.assertIsEqual(toString(sincos(angle, 8).sine), "-0.59847214");
+_.assertIsEqual(toString(atan2(fromInteger(1), fromInteger(1), 20)), "0.78539816339744830962");
+_.assertIsEqual(toString(atan2(fromInteger(0), fromInteger(-1), 10)), "3.1415926536");
+SECTION_END()
+
+SECTION(Primes)
+const auto factors = factorize(fromInteger(600851475143ULL));
+_.assertTrue(factors.size() == 4);
+_.assertIsEqual(toString(factors.front().prime), "71");
+_.assertIsEqual(toString(factors.back().prime), "6857");
+_.assertTrue(factorize(fromInteger(1024)).front().exponent == 10);
+_.assertTrue(isPrime(fromInteger(2305843009213693951ULL)));
+BigDecimal pseudoprime;
+parse("318665857834031151167461", pseudoprime);
+_.assertFalse(isPrime(pseudoprime));
+_.assertFalse(isPrime(fromInteger(1)));
+SECTION_END()
+
+SECTION(Greatest Common Divisor)
+BigDecimal a;
+BigDecimal b;
+// Consecutive Fibonacci numbers need every step of the Euclidean algorithm.
+parse("222232244629420445529739893461909967206666939096499764990979600", a);
+parse("137347080577163115432025771710279131845700275212767467264610201", b);
+_.assertIsEqual(toString(gcd(a, b)), "1");
+_.assertTrue(gcdBinary(a.mantissa, b.mantissa) == Limbs{ 1 });
+_.assertTrue(gcdLehmer(a.mantissa, b.mantissa) == Limbs{ 1 });
+const auto scaled = multiply(a, fromInteger(1ULL << 40));
+_.assertIsEqual(toString(gcd(scaled, multiply(b, fromInteger(1ULL << 40)))), "1099511627776");
+_.assertTrue(gcdBinary(scaled.mantissa, a.mantissa) == a.mantissa);
+_.assertTrue(gcdLehmer(scaled.mantissa, a.mantissa) == a.mantissa);
+_.assertIsEqual(toString(gcd(fromInteger(0), fromInteger(-12))), "12");
+SECTION_END()
+
+SECTION(Radix Conversion)
+BigDecimal number;
+parse("123456789012345678901234567890", number);
+_.assertIsEqual(toBase(number.mantissa, 16), "18EE90FF6C373E0EE4E3F0AD2");
+_.assertIsEqual(toBase(number.mantissa, 7), "21653251153414601406403630240331250");
+_.assertIsEqual(toBase({}, 2), "0");
+Limbs magnitude;
+_.assertTrue(fromBase("18ee90ff6c373e0ee4e3f0ad2", 16, magnitude) and magnitude == number.mantissa);
+_.assertFalse(fromBase("129", 8, magnitude));
+// Enough numerals to go through several levels of the power tree.
+const std::string numerals(3000, '1');
+_.assertTrue(fromBase(numerals, 3, magnitude) and toBase(magnitude, 3) == numerals);
+SECTION_END()
+
+SECTION(Multi-modular Arithmetic)
+const auto primes = modularPrimes(3);
+_.assertIsEqual(primes.size(), size_t{ 3 });
+_.assertTrue(primes[0] < (1ULL << MODULAR_PRIME_BITS) and primes[0] > primes[1] and primes[1] > primes[2]);
+_.assertTrue(isPrime(fromInteger(primes[2])));
+
+BigDecimal number;
+parse("-123456789012345678901234567890123", number);
+std::vector<std::uint64_t> residues;
+for (const auto prime : primes)
+{
+    const auto residue = remainderWord(number.mantissa, prime);
+    residues.push_back(residue == 0 ? 0 : prime - residue);
+}
+_.assertIsEqual(toString(chineseRemainder(residues, primes)), "-123456789012345678901234567890123");
+_.assertIsEqual(remainderWord(fromInteger(1000000007ULL * 3 + 5).mantissa, 1000000007), std::uint64_t{ 5 });
+SECTION_END()
+
+TEST_END()
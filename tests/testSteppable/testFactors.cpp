@@ -28,6 +28,8 @@
 
 #include <iomanip>
 #include <iostream>
+#include <string>
+#include <vector>
 
 TEST_START()
 using namespace steppable::__internals::numUtils;
@@ -39,6 +41,16 @@ _.assertFalse(isPrime("16"));
 _.assertFalse(isPrime("100"));
 _.assertFalse(isPrime("1000"));
 _.assertFalse(isPrime("10000"));
+_.assertTrue(isPrime("1000000007"));
+_.assertFalse(isPrime("600851475143"));
+_.assertTrue(isPrime("170141183460469231731687303715884105727"));
+SECTION_END()
+
+SECTION(Factors Test)
+const std::vector<std::string> twelve{ "1", "2", "3", "4", "6", "12" };
+_.assertTrue(getFactors("12") == twelve);
+_.assertTrue(getFactors("1000000007").size() == 2);
+_.assertTrue(getFactors("600851475143").size() == 16);
 SECTION_END()
 
 SECTION(Greatest Square Number Test)
@@ -46,6 +58,8 @@ _.assertIsEqual(getGreatestRootNum("2"), "1");
 _.assertIsEqual(getGreatestRootNum("3"), "1");
 _.assertIsEqual(getGreatestRootNum("4"), "4");
 _.assertIsEqual(getGreatestRootNum("5"), "4");
+_.assertIsEqual(getGreatestRootNum("1000", "3"), "1000");
+_.assertIsEqual(getGreatestRootNum("123456789012345678901234567890"), "123456789012345380023044696196");
 SECTION_END()
 
 SECTION(Greatest Root Factor Test)
@@ -53,6 +67,8 @@ _.assertIsEqual(getRootFactor("24", "2").getOutput(), "4");
 _.assertIsEqual(getRootFactor("13", "2").getOutput(), "1");
 _.assertIsEqual(getRootFactor("27", "2").getOutput(), "9");
 _.assertIsEqual(getRootFactor("72", "2").getOutput(), "36");
+_.assertIsEqual(getRootFactor("1000000", "3").getOutput(), "1000000");
+_.assertIsEqual(getRootFactor("1000000", "3").getInputs()[2], "100");
 SECTION_END()
 
 TEST_END()
@@ -53,6 +53,25 @@ _.assertIsEqual((Fraction("13122", "54251") / Fraction("22451", "3423")).present
 _.assertIsEqual((Fraction("22451", "3423") / Fraction("13122", "54251")).present(), "1217989201/44916606");
 SECTION_END()
 
+SECTION(Fraction Power)
+_.assertIsEqual((Fraction("2", "3") ^ Number("5")).present(), "32/243");
+_.assertIsEqual((Fraction("-2", "3") ^ Number("-3")).present(), "-27/8");
+SECTION_END()
+
+SECTION(Fraction Compound Assignment)
+auto fraction = Fraction("1", "6");
+fraction += Fraction("1", "10");
+_.assertIsEqual(fraction.present(), "4/15");
+fraction -= Fraction("4", "15");
+_.assertIsEqual(fraction.present(), "0/1");
+fraction = Fraction("14", "15");
+fraction *= Fraction("25", "21");
+_.assertIsEqual(fraction.present(), "10/9");
+fraction /= Fraction("-5", "3");
+_.assertIsEqual(fraction.present(), "-2/3");
+_.assertIsEqual(Fraction("3", "-6").present(), "-1/2");
+SECTION_END()
+
 SECTION(Fraction from Number)
 _.assertIsEqual(Fraction("0.25").present(), "1/4");
 _.assertIsEqual(Fraction("0.5").present(), "1/2");
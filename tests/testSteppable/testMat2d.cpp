@@ -27,6 +27,8 @@
 
 #include <iomanip>
 #include <iostream>
+#include <string>
+#include <vector>
 
 TEST_START()
 SECTION(Matrix multiplication)
@@ -52,6 +54,34 @@ _.assertIsEqual(mat3,
                 }));
 SECTION_END()
 
+SECTION(Matrix multiplication of large entries)
+// 70x70 operands with 37-digit entries are split with the Strassen-Winograd scheme.
+const size_t size = 70;
+const std::string large = "1000000000000000000000000000000000001";
+steppable::MatVec2D<steppable::Number> left(size, std::vector<steppable::Number>(size));
+for (size_t i = 0; i < size; i++)
+    for (size_t j = 0; j < size; j++)
+        left[i][j] = steppable::Number(std::to_string((i * size) + j + 1) + large.substr(1));
+const auto product = steppable::Matrix(left) * steppable::Matrix(size, size, steppable::Number(large));
+
+bool allEqual = true;
+for (size_t i = 0; i < size; i++)
+{
+    steppable::Number rowSum = 0;
+    for (const auto& value : left[i])
+        rowSum += value;
+    const auto expected = rowSum * steppable::Number(large);
+    for (size_t j = 0; j < size; j++)
+        allEqual = allEqual and product[{ .y = i, .x = j }] == expected;
+}
+_.assertTrue(allEqual);
+
+// Entries are multiplied exactly and rounded once.
+steppable::Matrix a({ { 0.5, 1.25, -2 } });
+steppable::Matrix b({ { steppable::Number("4") }, { steppable::Number("0.2") }, { steppable::Number("0.125") } });
+_.assertIsEqual((a * b)[{ .y = 0, .x = 0 }], steppable::Number(2));
+SECTION_END()
+
 SECTION(Transpose)
 steppable::Matrix mat2({
     { 1, 2, 1 },
@@ -74,6 +104,44 @@ steppable::Matrix mat2({
 _.assertIsEqual(mat2.det(), steppable::Number(-434928));
 SECTION_END()
 
+SECTION(Matrix views)
+steppable::Matrix matrix({
+    { 5, 4, 3 },
+    { 8, 9, 5 },
+});
+const auto data = matrix.getData();
+_.assertTrue(data.getRows() == 2);
+_.assertTrue(data.getCols() == 3);
+_.assertIsEqual(data[{ .y = 1, .x = 2 }], steppable::Number(5));
+_.assertIsEqual(data.row(1)[0], steppable::Number(8));
+_.assertIsEqual(data.col(1)[1], steppable::Number(9));
+
+// Writing through a view changes the matrix.
+matrix.col(2)[0] = 7;
+_.assertIsEqual(matrix, steppable::Matrix({ { 5, 4, 7 }, { 8, 9, 5 } }));
+
+steppable::Number sum = 0;
+for (const auto& value : matrix.col(0))
+    sum += value;
+_.assertIsEqual(sum, steppable::Number(13));
+SECTION_END()
+
+SECTION(Row echelon form)
+// The first column needs a row swap.
+steppable::Matrix matrix({
+    { 0, 2, 1 },
+    { 1, 1, 1 },
+    { 2, 4, 4 },
+});
+_.assertIsEqual(matrix.ref(),
+                steppable::Matrix({
+                    { 1, 1, 1 },
+                    { 0, 2, 1 },
+                    { 0, 0, 1 },
+                }));
+_.assertIsEqual(matrix.det(), steppable::Number(-2));
+SECTION_END()
+
 SECTION(Matrix slicing)
 steppable::Matrix matrix({
     { 5, 4, 3 },
@@ -114,6 +182,57 @@ _.assertIsEqual(matrix4,
                 }));
 SECTION_END()
 
+SECTION(Matrix addition and subtraction)
+steppable::Matrix a({
+    { 1, 2, 3 },
+    { 4, 5, 6 },
+});
+steppable::Matrix b({
+    { 6, 5, 4 },
+    { 3, 2, 1 },
+});
+_.assertIsEqual(a + b, steppable::Matrix({ { 7, 7, 7 }, { 7, 7, 7 } }));
+_.assertIsEqual(a - b, steppable::Matrix({ { -5, -3, -1 }, { 1, 3, 5 } }));
+_.assertIsEqual(-a, steppable::Matrix({ { -1, -2, -3 }, { -4, -5, -6 } }));
+
+// Temporaries on either side are reused for the result.
+steppable::Matrix c({ { 1, 0 }, { 0, 1 } });
+_.assertIsEqual(a * b.transpose() + c - steppable::Matrix({ { 2, 2 }, { 2, 2 } }),
+                steppable::Matrix({ { 27, 8 }, { 71, 27 } }));
+_.assertIsEqual(c - a * b.transpose(), steppable::Matrix({ { -27, -10 }, { -73, -27 } }));
+_.assertIsEqual(a * b.transpose() - b * a.transpose(), steppable::Matrix({ { 0, -63 }, { 63, 0 } }));
+SECTION_END()
+
+SECTION(Compound assignment)
+steppable::Matrix a({
+    { 1, 2 },
+    { 3, 4 },
+});
+steppable::Matrix b({
+    { 0, 1 },
+    { 1, 0 },
+});
+auto matrix = a;
+matrix += b;
+_.assertIsEqual(matrix, steppable::Matrix({ { 1, 3 }, { 4, 4 } }));
+matrix -= a;
+_.assertIsEqual(matrix, b);
+matrix *= steppable::Number(3);
+_.assertIsEqual(matrix, steppable::Matrix({ { 0, 3 }, { 3, 0 } }));
+matrix *= a;
+_.assertIsEqual(matrix, steppable::Matrix({ { 9, 12 }, { 3, 6 } }));
+
+matrix = a;
+matrix <<= b;
+_.assertIsEqual(matrix, steppable::Matrix({ { 1, 2, 0, 1 }, { 3, 4, 1, 0 } }));
+matrix = a;
+matrix >>= b;
+_.assertIsEqual(matrix, steppable::Matrix({ { 0, 1, 1, 2 }, { 1, 0, 3, 4 } }));
+matrix = a;
+matrix <<= matrix;
+_.assertIsEqual(matrix, steppable::Matrix({ { 1, 2, 1, 2 }, { 3, 4, 3, 4 } }));
+SECTION_END()
+
 SECTION(Matrix Rank)
 using namespace steppable::literals;
 
@@ -150,4 +269,151 @@ steppable::Matrix matrix2(
 auto test = (matrix2 ^ -1 ^ -1).roundOffValues(1);
 _.assertIsEqual(test, matrix2);
 SECTION_END()
+SECTION(Matrix power)
+steppable::Matrix a({
+    { 1, 2 },
+    { 3, 4 },
+});
+_.assertIsEqual(a ^ 0, steppable::Matrix::diag(2));
+_.assertIsEqual(a ^ 1, a);
+_.assertIsEqual(a ^ 5, a * a * a * a * a);
+auto matrix = a;
+matrix ^= 2;
+_.assertIsEqual(matrix, steppable::Matrix({ { 7, 10 }, { 15, 22 } }));
+
+// The Fibonacci numbers F(89), F(90) and F(91) do not fit in a double.
+steppable::Matrix fibonacci({
+    { 1, 1 },
+    { 1, 0 },
+});
+_.assertIsEqual(fibonacci ^ 90,
+                steppable::Matrix({
+                    { steppable::Number("4660046610375530309"), steppable::Number("2880067194370816120") },
+                    { steppable::Number("2880067194370816120"), steppable::Number("1779979416004714189") },
+                }));
+
+steppable::Matrix b({
+    { -1, 1.5 },
+    { 1, -1 },
+});
+_.assertIsEqual(b ^ -2, steppable::Matrix({ { 10, 12 }, { 8, 10 } }));
+SECTION_END()
+SECTION(LU decomposition)
+steppable::Matrix a({
+    { 2, 1, 1 },
+    { 4, -6, 0 },
+    { -2, 7, 2 },
+});
+const steppable::LUDecomposition lu(a);
+_.assertTrue(not lu.isSingular());
+_.assertTrue(lu.getPermutation() == std::vector<size_t>{ 1, 0, 2 });
+_.assertIsEqual(lu.upper(), steppable::Matrix({ { 4, -6, 0 }, { 0, 4, 1 }, { 0, 0, 1 } }));
+_.assertIsEqual(lu.lower() * lu.upper(), steppable::Matrix({ { 4, -6, 0 }, { 2, 1, 1 }, { -2, 7, 2 } }));
+_.assertIsEqual(lu.det(), steppable::Number(-16));
+
+// Two right-hand sides, whose solutions are (1, 2, 3) and (1, 0, -1).
+steppable::Matrix b({
+    { 7, 1 },
+    { -8, 4 },
+    { 18, -4 },
+});
+_.assertIsEqual(lu.solve(b), steppable::Matrix({ { 1, 1 }, { 2, 0 }, { 3, -1 } }));
+_.assertIsEqual(a * lu.inverse(), steppable::Matrix::diag(3));
+
+steppable::Matrix singular({
+    { 1, 2 },
+    { 2, 4 },
+});
+_.assertTrue(steppable::LUDecomposition(singular).isSingular());
+_.assertIsEqual(singular.det(), steppable::Number(0));
+SECTION_END()
+SECTION(Singular LU decomposition)
+// The last row is the first plus twice the second. Rounding leaves a tiny last pivot, but the exact rank shows that
+// the matrix is singular, so inverse(), solve() and A ^ -1 report an error instead of returning huge elements.
+steppable::Matrix integers({
+    { 209, -286, -862, 415, 73 },
+    { 518, 97, -644, -331, 920 },
+    { -75, 803, 156, 612, -489 },
+    { 334, -120, 771, -58, 205 },
+    { 1245, -92, -2150, -247, 1913 },
+});
+const steppable::LUDecomposition integersLU(integers);
+_.assertTrue(integersLU.isSingular());
+_.assertIsEqual(integersLU.det(), steppable::Number(0));
+_.assertIsEqual(integers.det(), steppable::Number(0));
+_.assertIsEqual(integers.rank(), steppable::Number(4));
+
+// Without an exact rank, a pivot that is tiny next to the rest of its column counts as zero.
+steppable::Matrix decimals({
+    { 0.1, 0.2, 0.3 },
+    { 0.4, 0.5, 0.6 },
+    { 0.7, 0.8, 0.9 },
+});
+const steppable::LUDecomposition decimalsLU(decimals);
+_.assertTrue(decimalsLU.isSingular());
+_.assertIsEqual(decimalsLU.det(), steppable::Number(0));
+_.assertIsEqual(decimals.det(steppable::EliminationMode::ROUNDED), steppable::Number(0));
+
+steppable::Matrix nearlySingular({
+    { 1, 1 },
+    { 1, 1.001 },
+});
+_.assertTrue(not steppable::LUDecomposition(nearlySingular).isSingular());
+SECTION_END()
+SECTION(Exact elimination)
+steppable::Matrix integers({
+    { steppable::Number("123456789012"), steppable::Number("1") },
+    { steppable::Number("987654321098"), steppable::Number("3") },
+});
+_.assertIsEqual(integers.det(), steppable::Number("-617283954062"));
+
+steppable::Matrix decimals({
+    { 0.5, 1.25 },
+    { -2, 0.1 },
+});
+_.assertIsEqual(decimals.det(steppable::EliminationMode::EXACT), steppable::Number("2.55"));
+
+// 3x + y = 1 and x + 2y = 0, so x = 2/5 and y = -1/5.
+steppable::Matrix system({
+    { 3, 1, 1 },
+    { 1, 2, 0 },
+});
+const auto fractions = system.rrefFractions();
+_.assertTrue(fractions[0][0] == steppable::Fraction("1", "1") and fractions[0][1] == steppable::Fraction("0", "1"));
+_.assertTrue(fractions[0][2] == steppable::Fraction("2", "5"));
+_.assertTrue(fractions[1][2] == steppable::Fraction("-1", "5"));
+_.assertIsEqual(system.rref(), steppable::Matrix({ { 1, 0, 0.4 }, { 0, 1, -0.2 } }));
+
+steppable::Matrix dependent({
+    { 1, 2, 3 },
+    { 2, 4, 6 },
+    { 1, 1, 1 },
+});
+_.assertIsEqual(dependent.rank(), steppable::Number(2));
+_.assertIsEqual(dependent.det(), steppable::Number(0));
+SECTION_END()
+SECTION(Multi-modular elimination)
+// Large enough to be eliminated modulo primes. The determinant does not fit in a double.
+steppable::Matrix matrix({
+    { 60, -34, 90, -8, 77, 90, 67, 36, -92 },
+    { 20, 99, -36, 67, -86, -59, -71, -4, 21 },
+    { -36, -2, 40, -73, 47, -36, -96, 88, -44 },
+    { 5, -28, -53, 97, 0, -59, 96, -81, -64 },
+    { 59, 59, 14, -67, -66, -99, -98, -46, 99 },
+    { -44, -57, -57, -25, -19, -49, 39, 74, 61 },
+    { -47, -53, 77, -49, -1, -23, -94, -7, 7 },
+    { -57, -62, -32, -83, -15, -22, 55, 51, -99 },
+    { 53, 74, 82, -13, -83, -20, -9, -21, 24 },
+});
+_.assertIsEqual(matrix.det(), steppable::Number("-5240798134342147950"));
+_.assertIsEqual(matrix.rank(), steppable::Number(9));
+
+// The first column twice, followed by the next seven.
+auto singular = matrix;
+singular >>= matrix[{ .y1 = 0, .x1 = 0, .y2 = 8, .x2 = 0 }];
+_.assertIsEqual(singular.rank(), steppable::Number(9));
+singular = singular[{ .y1 = 0, .x1 = 0, .y2 = 8, .x2 = 8 }];
+_.assertIsEqual(singular.det(), steppable::Number(0));
+_.assertIsEqual(singular.rank(), steppable::Number(8));
+SECTION_END()
 TEST_END()
@@ -58,6 +58,23 @@ SECTION_END()
 
 SECTION(Test Power)
 _.assertIsEqual((Number("12") ^ Number("45")).present(), "3657261988008837196714082302655030834027437228032");
+_.assertIsEqual((Number("2", 5) ^ Number("-3")).present(), "0.12500");
+SECTION_END()
+
+SECTION(Test Presentation)
+_.assertIsEqual(Number("1.50").present(), "1.50");
+_.assertIsEqual(Number("-0.000123").present(), "-0.000123");
+_.assertIsEqual(Number(-42).present(), "-42");
+_.assertIsEqual(Number("Infinity").present(), "Infinity");
+_.assertIsEqual((Number("1.25") + Number("1.75")).present(), "3");
+_.assertIsEqual((Number("1.5") * Number("1.5")).present(), "2.2500000000");
+SECTION_END()
+
+SECTION(Test Promotion)
+_.assertIsEqual(Number(-9223372036854775807LL - 1).present(), "-9223372036854775808");
+_.assertIsEqual((Number(18446744073709551615ULL) + Number(1)).present(), "18446744073709551616");
+_.assertIsEqual((Number(4294967296) * Number(4294967296)).present(), "18446744073709551616");
+_.assertIsEqual((Number("18446744073709551616") - Number(1)).present(), "18446744073709551615");
 SECTION_END()
 
 SECTION(Test Equalities and Inequalities)
@@ -67,6 +84,10 @@ _.assertTrue(Number("123") < Number("456"));
 _.assertTrue(Number("456") > Number("123"));
 _.assertTrue(Number("123") <= Number("456"));
 _.assertTrue(Number("456") >= Number("123"));
+_.assertTrue(Number("1.50") == Number("1.5"));
+_.assertTrue(Number("-0.5") < Number("0.25"));
+_.assertTrue((Number("1.50") <=> Number("1.5")) == 0);
+_.assertTrue((Number("Infinity") <=> Number("1")) == std::partial_ordering::unordered);
 SECTION_END()
 
 SECTION(Test Increment and Decrement)
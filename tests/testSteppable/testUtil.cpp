@@ -27,8 +27,12 @@
 #include "testing.hpp"
 #include "util.hpp"
 
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
 #include <iomanip>
 #include <iostream>
+#include <vector>
 #include <rounding.hpp>
 
 TEST_START()
@@ -190,4 +194,48 @@ _.assertTrue(isPowerOfTen("0.01"));
 _.assertFalse(isPowerOfTen("20"));
 SECTION_END()
 
+SECTION(Loop)
+using namespace steppable::__internals::calc;
+std::string indices;
+loop("3", [&](const std::string& index) { indices += index; });
+_.assertIsEqual(indices, "012");
+indices.clear();
+loop("2.5", [&](const std::string& index) { indices += index; });
+_.assertIsEqual(indices, "012");
+size_t count = 0;
+loop("100000", [&](const auto&) { count++; });
+_.assertTrue(count == 100000);
+loop("-1", [&](const auto&) { count++; });
+_.assertTrue(count == 100000);
+SECTION_END()
+
+SECTION(Parallel Loop)
+using namespace steppable::__internals::calc;
+std::atomic<std::uint64_t> sum = 0;
+parallelLoop("100000", [&](const LoopIndex& index) { sum += index.value; });
+_.assertTrue(sum == 4999950000);
+std::vector<int> visited(1000, 0);
+parallelLoop("1000", [&](const LoopIndex& index) { visited[index.value]++; });
+_.assertTrue(std::ranges::all_of(visited, [](const int times) { return times == 1; }));
+parallelLoop("0", [&](const LoopIndex&) { sum = 0; });
+_.assertTrue(sum == 4999950000);
+SECTION_END()
+
+SECTION(Loop Count)
+using namespace steppable::__internals::calc;
+std::uint64_t count = 1;
+_.assertTrue(loopCount("12.5", count) == LoopCount::COUNTED);
+_.assertTrue(count == 13);
+_.assertTrue(loopCount("-4", count) == LoopCount::COUNTED);
+_.assertTrue(count == 0);
+_.assertTrue(loopCount("abc", count) == LoopCount::NOT_A_NUMBER);
+_.assertTrue(count == 0);
+_.assertTrue(loopCount("1" + std::string(30, '0'), count) == LoopCount::TOO_LARGE);
+_.assertTrue(count == 0);
+size_t calls = 0;
+loop("abc", [&](const LoopIndex&) { calls++; });
+parallelLoop("abc", [&](const LoopIndex&) { calls++; });
+_.assertTrue(calls == 0);
+SECTION_END()
+
 TEST_END()